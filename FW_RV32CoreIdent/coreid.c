@@ -21,6 +21,12 @@
 /*! Maximum length of assembled extension name                                */
 #define EXT_NAME_MAX_LEN            (64u)
 
+/*! Position of the MXL field: the two most significant bits of MISA          */
+#define MISA_MXL_POS                ((unsigned)HW_XLEN - 2u)
+
+/*! Mask of the MXL field                                                     */
+#define MISA_MXL_MSK                (0x3u)
+
 
 /*- Private variables --------------------------------------------------------*/
 /*! Lookup table for ISA-Extension names                                      */
@@ -81,14 +87,18 @@ static bool bIsExtensionValid(char cExt)
  * @brief
  * Read the core XLEN from the MISA CSR
  *
+ * @note
+ * The MXL field position depends on the native register width, which is
+ * fixed at compile time, so the shift and mask are constants.
+ *
  * @return  (coreid_xlen) Register width
  * @retval  EN_COREID_XLEN_Unknown  Invalid encoding
  * @date  29.05.2023
  ******************************************************************************/
 coreid_xlen eCoreIdGetXlen(void)
 {
-  register uint32_t ulMxl = (__get_MISA() >> 30) & 0x3u;
-  switch (ulMxl)
+  register unsigned uMxl = (unsigned)((HW_GET_MISA() >> MISA_MXL_POS) & MISA_MXL_MSK);
+  switch (uMxl)
   {
   case 0x1u:  return EN_COREID_XLEN_32b;
   case 0x2u:  return EN_COREID_XLEN_64b;
@@ -109,8 +119,8 @@ bool bCoreIdIsExtensionPresent(char cExt)
 {
   if (bIsExtensionValid(cExt))
   {
-    register uint32_t ulMisa = __get_MISA();
-    return !!(ulMisa & (1u << (unsigned)(cExt - 'A')));
+    register hw_reg xMisa = HW_GET_MISA();
+    return !!(xMisa & (1u << (unsigned)(cExt - 'A')));
   }
   else return false;
 }
@@ -160,10 +170,10 @@ void vCoreIdGetPresentExtensions(void (*pfvExtensionCallback)(char cExt))
 {
   if (pfvExtensionCallback == NULL) return;
 
-  uint32_t ulMisa = __get_MISA();
+  hw_reg xMisa = HW_GET_MISA();
 
   for (char c = 'A'; c <= 'Z'; ++c)
   {
-    if (ulMisa & (1u << (c - 'A'))) pfvExtensionCallback(c);
+    if (xMisa & (1u << (c - 'A'))) pfvExtensionCallback(c);
   }
 }
@@ -0,0 +1,54 @@
+/*!****************************************************************************
+ * @file
+ * csr_trace.h
+ *
+ * @brief
+ * CSR Trace Capture Format
+ *
+ * A capture is a header followed by one record per CSR read access, in the
+ * order the accesses were made. All fields are little-endian. Captures are
+ * recorded on the device (HW_CSR_TRACE) and replayed by the host test stub.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef CSR_TRACE_H_
+#define CSR_TRACE_H_
+
+/*- Header files -------------------------------------------------------------*/
+#include <stdint.h>
+
+
+/*- Macros -------------------------------------------------------------------*/
+/*! Capture file magic, "CSRT"                                                */
+#define CSR_TRACE_MAGIC           (0x54525343u)
+
+/*! Capture format version                                                    */
+#define CSR_TRACE_VERSION         (1u)
+
+/*! CSR addresses used as record IDs                                          */
+#define CSR_TRACE_ID_MISA         (0x301u)
+
+
+/*- Type definitions ---------------------------------------------------------*/
+/*! Capture header                                                            */
+typedef struct
+{
+  uint32_t ulMagic;                   /*!< CSR_TRACE_MAGIC                    */
+  uint8_t ubVersion;                  /*!< CSR_TRACE_VERSION                  */
+  uint8_t ubXlen;                     /*!< Register width of the device       */
+  uint16_t uwRecordSize;              /*!< sizeof(csr_trace_record)           */
+  uint32_t ulRecordCount;             /*!< Number of records                  */
+  uint32_t ulReserved;                /*!< Reserved, 0                        */
+} csr_trace_header;
+
+/*! Capture record of a single CSR read access                                */
+typedef struct
+{
+  uint64_t ullValue;                  /*!< Value read, zero-extended          */
+  uint32_t ulOrder;                   /*!< Access sequence number             */
+  uint16_t uwCsr;                     /*!< CSR address                        */
+  uint16_t uwReserved;                /*!< Reserved, 0                        */
+} csr_trace_record;
+
+#endif /* CSR_TRACE_H_ */
@@ -13,6 +13,62 @@
 
 /*- Header files -------------------------------------------------------------*/
 #include <stddef.h>
+#include <stdint.h>
 #include "ch32v00x.h"
 
+
+/*- Register width -----------------------------------------------------------*/
+/*! Native register width in bits, as selected by -march=rv32/rv64/rv128      */
+#if defined(__riscv_xlen)
+#define HW_XLEN                   __riscv_xlen
+#else
+#define HW_XLEN                   32
+#endif
+
+/*! Native register type                                                      */
+#if HW_XLEN == 32
+typedef uint32_t hw_reg;
+#elif HW_XLEN == 64
+typedef uint64_t hw_reg;
+#elif HW_XLEN == 128
+typedef unsigned __int128 hw_reg;
+#else
+#error "Unsupported register width"
+#endif
+
+
+/*- CSR access ---------------------------------------------------------------*/
+/*! Read the MISA CSR with the native register width                          */
+#if HW_XLEN == 32
+#define HW_READ_MISA()            __get_MISA()
+#else
+#define HW_READ_MISA()                                                        \
+  __extension__ ({                                                            \
+    hw_reg xMisa;                                                             \
+    __asm volatile ("csrr %0, misa" : "=r" (xMisa));                          \
+    xMisa;                                                                    \
+  })
+#endif
+
+/*!
+ * CSR read accessors used by the application
+ *
+ * With HW_CSR_TRACE defined, every read is passed to vHwCsrTraceRecord(),
+ * which needs to be provided by the application (see csr_trace.h).
+ */
+#ifdef HW_CSR_TRACE
+#include "csr_trace.h"
+
+void vHwCsrTraceRecord(uint16_t uwCsr, uint64_t ullValue);
+
+#define HW_GET_MISA()                                                         \
+  __extension__ ({                                                            \
+    hw_reg xTraced = HW_READ_MISA();                                          \
+    vHwCsrTraceRecord(CSR_TRACE_ID_MISA, (uint64_t)xTraced);                  \
+    xTraced;                                                                  \
+  })
+#else
+#define HW_GET_MISA()             HW_READ_MISA()
+#endif
+
 #endif /* HW_LAYER_H_ */
@@ -0,0 +1,71 @@
+/*!****************************************************************************
+ * @file
+ * identify.c
+ *
+ * @brief
+ * Core Identification Sequence
+ *
+ * The sequence run by the firmware on start-up. It is shared with the host
+ * capture replay tool, so captures recorded on a device are replayed against
+ * exactly the calls that produced them.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Header files -------------------------------------------------------------*/
+#include <stddef.h>
+#include "identify.h"
+
+
+/*- Private variables --------------------------------------------------------*/
+/*! Result the present extensions are listed into                             */
+static identify_result* pxListResult;
+
+
+/*- Private functions --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Callback of vCoreIdGetPresentExtensions(), adds an extension to the list
+ *
+ * @param[in] cExt        Extension letter
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vListExtension(char cExt)
+{
+  pxListResult->ulListed |= IDENTIFY_EXT_BIT(cExt);
+}
+
+
+/*- Exported functions -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Identify the core, using every function of the Core ID interface
+ *
+ * The register width is read first, then every extension letter from A to Z
+ * is queried and the present extensions are listed.
+ *
+ * @param[out] *pxResult  Identification results
+ * @param[in] pfvNameCallback Called with the name of every extension reported
+ *                      present, may be NULL
+ * @date  19.10.2026
+ ******************************************************************************/
+void vIdentifyCore(identify_result* pxResult,
+                   void (*pfvNameCallback)(char cExt, const char* pszName))
+{
+  pxResult->eXlen = eCoreIdGetXlen();
+
+  pxResult->ulPresent = 0u;
+  for (char c = 'A'; c <= 'Z'; ++c)
+  {
+    if (!bCoreIdIsExtensionPresent(c)) continue;
+
+    pxResult->ulPresent |= IDENTIFY_EXT_BIT(c);
+    const char* pszName = pszCoreIdGetExtensionName(c);
+    if (pfvNameCallback != NULL) pfvNameCallback(c, pszName);
+  }
+
+  pxResult->ulListed = 0u;
+  pxListResult = pxResult;
+  vCoreIdGetPresentExtensions(vListExtension);
+  pxListResult = NULL;
+}
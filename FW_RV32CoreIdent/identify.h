@@ -0,0 +1,39 @@
+/*!****************************************************************************
+ * @file
+ * identify.h
+ *
+ * @brief
+ * Core Identification Sequence
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef IDENTIFY_H_
+#define IDENTIFY_H_
+
+/*- Header files -------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include "coreid.h"
+
+
+/*- Macros -------------------------------------------------------------------*/
+/*! Bit of an extension letter in the extension masks                         */
+#define IDENTIFY_EXT_BIT(cExt)    (UINT32_C(1) << (unsigned)((cExt) - 'A'))
+
+
+/*- Type definitions ---------------------------------------------------------*/
+/*! Results of the identification sequence                                    */
+typedef struct
+{
+  coreid_xlen eXlen;                  /*!< Register width                     */
+  uint32_t ulPresent;                 /*!< Extensions reported present        */
+  uint32_t ulListed;                  /*!< Extensions listed as present       */
+} identify_result;
+
+
+/*- Exported functions -------------------------------------------------------*/
+void vIdentifyCore(identify_result* pxResult,
+                   void (*pfvNameCallback)(char cExt, const char* pszName));
+
+#endif /* IDENTIFY_H_ */
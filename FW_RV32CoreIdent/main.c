@@ -11,12 +11,58 @@
 /*- Header files -------------------------------------------------------------*/
 #include "hw_layer.h"
 #include "coreid.h"
+#include "identify.h"
 
 
 /*- Global variables ---------------------------------------------------------*/
 /* Access these variables using the debugger                                  */
 volatile coreid_xlen eXlen;
 volatile bool bRV32E;
+identify_result xCoreIdent;
+
+
+#ifdef HW_CSR_TRACE
+/*- CSR trace capture --------------------------------------------------------*/
+/*! Maximum number of captured CSR reads (identification sequence: 28)        */
+#define CSR_TRACE_CAPACITY        (32u)
+
+/* Dump this variable using the debugger to obtain a capture file             */
+volatile struct
+{
+  csr_trace_header xHeader;
+  csr_trace_record axRecords[CSR_TRACE_CAPACITY];
+} xCsrTrace = {
+  .xHeader = {
+    .ulMagic = CSR_TRACE_MAGIC,
+    .ubVersion = CSR_TRACE_VERSION,
+    .ubXlen = HW_XLEN,
+    .uwRecordSize = sizeof(csr_trace_record)
+  }
+};
+
+/*!****************************************************************************
+ * @brief
+ * Record a CSR read access into the capture
+ *
+ * @note
+ * Accesses beyond the capture capacity are dropped.
+ *
+ * @param[in] uwCsr       CSR address
+ * @param[in] ullValue    Value read
+ * @date  19.10.2026
+ ******************************************************************************/
+void vHwCsrTraceRecord(uint16_t uwCsr, uint64_t ullValue)
+{
+  uint32_t ulIndex = xCsrTrace.xHeader.ulRecordCount;
+  if (ulIndex >= CSR_TRACE_CAPACITY) return;
+
+  xCsrTrace.axRecords[ulIndex].ullValue = ullValue;
+  xCsrTrace.axRecords[ulIndex].ulOrder = ulIndex;
+  xCsrTrace.axRecords[ulIndex].uwCsr = uwCsr;
+  xCsrTrace.axRecords[ulIndex].uwReserved = 0u;
+  xCsrTrace.xHeader.ulRecordCount = ulIndex + 1u;
+}
+#endif
 
 
 /*!****************************************************************************
@@ -27,8 +73,9 @@ volatile bool bRV32E;
  ******************************************************************************/
 int main(void)
 {
-  bRV32E = bCoreIdIsExtensionPresent('E');
-  eXlen = eCoreIdGetXlen();
+  vIdentifyCore(&xCoreIdent, NULL);
+  eXlen = xCoreIdent.eXlen;
+  bRV32E = ((xCoreIdent.ulPresent & IDENTIFY_EXT_BIT('E')) != 0u);
 
   while (1);
 }
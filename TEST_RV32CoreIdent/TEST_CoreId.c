@@ -9,7 +9,10 @@
  ******************************************************************************/
 
 /*- Test environment ---------------------------------------------------------*/
+#include <stdlib.h>
+#include <unistd.h>
 #include <CuTest.h>
+#include "runner.h"
 #include "lambda.h"
 
 
@@ -17,8 +20,16 @@
 #include "Stub_CSRs.h"
 
 
+/*- Test data ----------------------------------------------------------------*/
+#include "CoreProfiles.h"
+
+
 /*- Unit-Under-Test ----------------------------------------------------------*/
-#include "../../FW_RV32CoreIdent/coreid.c"
+/* UUT_SOURCE may be overridden to test a mutated copy of the UUT             */
+#ifndef UUT_SOURCE
+#define UUT_SOURCE "../../FW_RV32CoreIdent/coreid.c"
+#endif
+#include UUT_SOURCE
 
 
 /*- Stub implementation for CoreID -------------------------------------------*/
@@ -76,7 +87,7 @@ TEST_GROUP(TestCoreId_IsExtensionValid)
 TEST_CASE(TEST_CoreId_GetXlen_Valid32)
 {
   vStub_CSRs_Reset();
-  vStub_CSRs_SetMisa(0x40000000u);
+  vStub_CSRs_SetMisa(STUB_MISA_MXL(0x1u));
 
   const coreid_xlen eExpected = EN_COREID_XLEN_32b;
 
@@ -85,6 +96,64 @@ TEST_CASE(TEST_CoreId_GetXlen_Valid32)
   CuAssertIntEquals(eExpected, eActual);
 }
 
+/*!****************************************************************************
+ * @brief
+ * Valid encoding for "RV64"
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_GetXlen_Valid64)
+{
+  vStub_CSRs_Reset();
+  vStub_CSRs_SetMisa(STUB_MISA_MXL(0x2u));
+
+  const coreid_xlen eExpected = EN_COREID_XLEN_64b;
+
+  coreid_xlen eActual = eCoreIdGetXlen();
+
+  CuAssertIntEquals(eExpected, eActual);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Valid encoding for "RV128"
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_GetXlen_Valid128)
+{
+  vStub_CSRs_Reset();
+  vStub_CSRs_SetMisa(STUB_MISA_MXL(0x3u));
+
+  const coreid_xlen eExpected = EN_COREID_XLEN_128b;
+
+  coreid_xlen eActual = eCoreIdGetXlen();
+
+  CuAssertIntEquals(eExpected, eActual);
+}
+
+/*!****************************************************************************
+ * @brief
+ * MXL field at the position of the other register width is not decoded
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_GetXlen_OtherWidthPosition)
+{
+  vStub_CSRs_Reset();
+#if HW_XLEN == 32
+  vStub_CSRs_SetMisa(STUB_MISA_RV64_MXL(0x2u));
+#else
+  vStub_CSRs_SetMisa(STUB_MISA_RV32_MXL(0x1u));
+#endif
+
+  const coreid_xlen eExpected = EN_COREID_XLEN_Unknown;
+
+  coreid_xlen eActual = eCoreIdGetXlen();
+
+  CuAssertIntEquals(eExpected, eActual);
+}
+
 /*!****************************************************************************
  * @brief
  * Invalid encoding
@@ -106,6 +175,9 @@ TEST_CASE(TEST_CoreId_GetXlen_Invalid)
 TEST_GROUP(TestCoreId_GetXlen)
 {
   TEST_CoreId_GetXlen_Valid32,
+  TEST_CoreId_GetXlen_Valid64,
+  TEST_CoreId_GetXlen_Valid128,
+  TEST_CoreId_GetXlen_OtherWidthPosition,
   TEST_CoreId_GetXlen_Invalid
 };
 
@@ -290,6 +362,238 @@ TEST_GROUP(TestCoreId_GetPresentExtensions)
 };
 
 
+/*- Core profile tests -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Load the MISA value of the current core profile into the stub
+ *
+ * @return  (const core_profile*) Current core profile
+ * @date  19.10.2026
+ ******************************************************************************/
+static const core_profile* pxSetupProfile(void)
+{
+  const core_profile* pxProfile = pvRunner_GetParam();
+
+  vStub_CSRs_Reset();
+  vStub_CSRs_SetMisa(pxProfile->ullMisa);
+
+  return pxProfile;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Register width of the core
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_Profile_Xlen)
+{
+  const core_profile* pxProfile = pxSetupProfile();
+
+  const coreid_xlen eExpected = pxProfile->eXlen;
+
+  coreid_xlen eActual = eCoreIdGetXlen();
+
+  CuAssertIntEquals(eExpected, eActual);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Presence of every extension code of the core
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_Profile_IsExtensionPresent)
+{
+  const core_profile* pxProfile = pxSetupProfile();
+
+  const char* pszExpected = pxProfile->pszExtensions;
+
+  char acActual[CORE_PROFILE_EXT_COUNT + 1u] = { 0 };
+  size_t ulLen = 0u;
+  for (char cExt = 'A'; cExt <= 'Z'; ++cExt)
+  {
+    if (bCoreIdIsExtensionPresent(cExt)) acActual[ulLen++] = cExt;
+  }
+
+  CuAssertStrEquals(pszExpected, acActual);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Extensions of the core are reported in order, with a single MISA access
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_Profile_GetPresentExtensions)
+{
+  const core_profile* pxProfile = pxSetupProfile();
+
+  const char* pszExpected = pxProfile->pszExtensions;
+  const uint32_t ulExpectedAccesses = 1u;
+
+  char acActual[CORE_PROFILE_EXT_COUNT + 1u] = { 0 };
+  size_t ulLen = 0u;
+  BEGIN_LAMBDA_SECTION();
+  vCoreIdGetPresentExtensions(LAMBDA((char cExt), void, {
+    if (ulLen < CORE_PROFILE_EXT_COUNT) acActual[ulLen++] = cExt;
+  }));
+  END_LAMBDA_SECTION();
+  uint32_t ulActualAccesses = ulStub_CSRs_GetMisaAccessCount();
+
+  CuAssertStrEquals(pszExpected, acActual);
+  CuAssertIntEquals(ulExpectedAccesses, ulActualAccesses);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Names of the extensions of the core
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_Profile_GetExtensionName)
+{
+  const core_profile* pxProfile = pxSetupProfile();
+
+  for (const char* pcExt = pxProfile->pszExtensions; *pcExt != '\0'; ++pcExt)
+  {
+    const char* pszExpected = apszCoreProfileExtNames[(unsigned)(*pcExt - 'A')];
+
+    const char* pszActual = pszCoreIdGetExtensionName(*pcExt);
+
+    CuAssertStrEquals(pszExpected, pszActual);
+  }
+}
+
+/*! Test group definition for the core profiles                               */
+TEST_PARAM_GROUP(TestCoreId_Profiles, axCoreProfiles, CORE_PROFILE_COUNT)
+{
+  TEST_CoreId_Profile_Xlen,
+  TEST_CoreId_Profile_IsExtensionPresent,
+  TEST_CoreId_Profile_GetPresentExtensions,
+  TEST_CoreId_Profile_GetExtensionName
+};
+
+
+/*- Capture replay tests -----------------------------------------------------*/
+/*! MISA value of the recorded capture (RV32EC)                               */
+#define REPLAY_MISA               (STUB_MISA_MXL(0x1u) | (0x1u << 2) | (0x1u << 4))
+
+/*!****************************************************************************
+ * @brief
+ * Record a capture of a short identification sequence and start its replay
+ *
+ * If recording or replay fails, the capture file is removed again, so the
+ * caller only needs to remove it after a successful call.
+ *
+ * @param[out] *acFile    Capture file name, at least 32 chars
+ * @return  (bool)      true, if the capture was recorded and is replayed
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool bRecordCapture(char* acFile)
+{
+  strcpy(acFile, "/tmp/coreid_XXXXXX");
+  int iFd = mkstemp(acFile);
+  if (iFd < 0) return false;
+  close(iFd);
+
+  vStub_CSRs_Reset();
+  vStub_CSRs_SetMisa(REPLAY_MISA);
+  bool bOk = bStub_CSRs_RecordStart(acFile);
+  if (bOk)
+  {
+    (void)bCoreIdIsExtensionPresent('E');
+    (void)eCoreIdGetXlen();
+  }
+  bOk = bStub_CSRs_RecordStop() && bOk;
+
+  vStub_CSRs_Reset();
+  bOk = bOk && bStub_CSRs_ReplayStart(acFile);
+  if (!bOk)
+  {
+    vStub_CSRs_Reset();
+    unlink(acFile);
+  }
+  return bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Replay of the identification sequence yields the recorded values
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_Replay_Sequence)
+{
+  char acFile[32];
+  const bool bRecorded = bRecordCapture(acFile);
+  CuAssert(bRecorded, "Capture not recorded");
+
+  const bool bExpectedE = true;
+  const coreid_xlen eExpectedXlen = EN_COREID_XLEN_32b;
+
+  bool bActualE = bCoreIdIsExtensionPresent('E');
+  coreid_xlen eActualXlen = eCoreIdGetXlen();
+  const char* pszDivergence = pszStub_CSRs_ReplayCheck();
+
+  vStub_CSRs_Reset();
+  unlink(acFile);
+  CuAssertIntEquals(bExpectedE, bActualE);
+  CuAssertIntEquals(eExpectedXlen, eActualXlen);
+  CuAssert(pszDivergence == NULL, pszDivergence);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reading more often than recorded is reported as divergence
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_Replay_ExtraRead)
+{
+  char acFile[32];
+  const bool bRecorded = bRecordCapture(acFile);
+  CuAssert(bRecorded, "Capture not recorded");
+
+  (void)bCoreIdIsExtensionPresent('E');
+  (void)eCoreIdGetXlen();
+  (void)eCoreIdGetXlen();
+  bool bDiverged = (pszStub_CSRs_ReplayCheck() != NULL);
+
+  vStub_CSRs_Reset();
+  unlink(acFile);
+  CuAssert(bDiverged, "Divergence not reported");
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reading less often than recorded is reported as divergence
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+TEST_CASE(TEST_CoreId_Replay_MissingRead)
+{
+  char acFile[32];
+  const bool bRecorded = bRecordCapture(acFile);
+  CuAssert(bRecorded, "Capture not recorded");
+
+  (void)bCoreIdIsExtensionPresent('E');
+  bool bDiverged = (pszStub_CSRs_ReplayCheck() != NULL);
+
+  vStub_CSRs_Reset();
+  unlink(acFile);
+  CuAssert(bDiverged, "Divergence not reported");
+}
+
+/*! Test group definition for capture replay                                  */
+TEST_GROUP(TestCoreId_Replay)
+{
+  TEST_CoreId_Replay_Sequence,
+  TEST_CoreId_Replay_ExtraRead,
+  TEST_CoreId_Replay_MissingRead
+};
+
+
 /*- Test module definition ---------------------------------------------------*/
 TEST_MODULE(TestCoreId)
 {
@@ -297,5 +601,7 @@ TEST_MODULE(TestCoreId)
   TestCoreId_GetXlen,
   TestCoreId_IsExtensionPresent,
   TestCoreId_GetExtensionName,
-  TestCoreId_GetPresentExtensions
+  TestCoreId_GetPresentExtensions,
+  TestCoreId_Profiles,
+  TestCoreId_Replay
 };
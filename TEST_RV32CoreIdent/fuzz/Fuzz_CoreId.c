@@ -0,0 +1,417 @@
+/*!****************************************************************************
+ * @file
+ * Fuzz_CoreId.c
+ *
+ * @brief
+ * In-process fuzz target for the "Core ID" unit under test
+ *
+ * Every input is decoded into a MISA register value followed by a sequence of
+ * extension chars. Each char is fed through the complete module API via the
+ * CSR stub, and the results are checked against a reference model. Any
+ * violation aborts the process, so the target may be driven by libFuzzer
+ * (-DFUZZ_LIBFUZZER), AFL++ persistent mode (afl-clang-fast) or the built-in
+ * persistent driver. Extension names are checked against the independent
+ * reference table of the core profiles.
+ *
+ * Input format, with N = sizeof(hw_reg), the simulated register width:
+ *   [0..N-1] MISA register value, little-endian
+ *   [N..]    Extension chars to be queried
+ * The seed corpus is written for the default register width of 32 bits.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Header files -------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/*- Stubs --------------------------------------------------------------------*/
+#include "Stub_CSRs.h"
+
+
+/*- Test data ----------------------------------------------------------------*/
+#include "CoreProfiles.h"
+
+
+/*- Unit-Under-Test ----------------------------------------------------------*/
+#include "../../FW_RV32CoreIdent/coreid.c"
+
+
+/*- Macros -------------------------------------------------------------------*/
+/*! Size of the MISA header in every input                                    */
+#define FUZZ_MISA_LEN               (sizeof(hw_reg))
+
+/*! Maximum input length generated by the built-in driver                     */
+#define FUZZ_MAX_INPUT_LEN          (64u)
+
+/*! Maximum number of corpus entries kept by the built-in driver            */
+#define FUZZ_MAX_CORPUS             (256u)
+
+/*! Default number of iterations for the built-in driver                      */
+#define FUZZ_DEFAULT_RUNS           (10000000ul)
+
+/*! Invariant check, aborts with a diagnostic on violation                    */
+#define FUZZ_CHECK(cond)                                                      \
+  do {                                                                        \
+    if (!(cond)) vFuzzFail(#cond, __LINE__, xMisa, cExt);                     \
+  } while (0)
+
+
+/*- AFL++ shared memory test case buffer -------------------------------------*/
+#ifdef __AFL_FUZZ_TESTCASE_LEN
+__AFL_FUZZ_INIT();
+#endif
+
+
+/*- Private variables --------------------------------------------------------*/
+/*! Extensions reported by vCoreIdGetPresentExtensions, in order of calls     */
+static char acPresentExtensions[EXT_NAMES_LUT_LEN + 1u];
+
+/*! Number of callback invocations                                            */
+static size_t ulPresentExtensionCount;
+
+
+/*- Private functions --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Report an invariant violation and abort
+ *
+ * @param[in] *pszCond    Violated condition
+ * @param[in] iLine       Source line of the check
+ * @param[in] xMisa       MISA value of the failing input
+ * @param[in] cExt        Extension char of the failing input
+ * @date  19.10.2026
+ ******************************************************************************/
+static void __attribute__((noreturn)) vFuzzFail(const char* pszCond, int iLine,
+                                                hw_reg xMisa, char cExt)
+{
+  fprintf(stderr, "Fuzz_CoreId.c:%d: invariant violated: %s "
+                  "(MISA=0x%0*llx, ext=0x%02x)\n",
+          iLine, pszCond, (int)(HW_XLEN / 4), (unsigned long long)xMisa,
+          (unsigned)(unsigned char)cExt);
+  abort();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Record every extension reported by vCoreIdGetPresentExtensions
+ *
+ * @param[in] cExt        Extension
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vRecordExtension(char cExt)
+{
+  if (ulPresentExtensionCount < EXT_NAMES_LUT_LEN)
+  {
+    acPresentExtensions[ulPresentExtensionCount] = cExt;
+  }
+  ++ulPresentExtensionCount;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reference model: extension char validity
+ *
+ * @param[in] cExt        Extension
+ * @return  (bool)      true, if the char is an uppercase ASCII letter
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool bRefIsExtensionValid(char cExt)
+{
+  unsigned char ucExt = (unsigned char)cExt;
+  return (ucExt >= 0x41u) && (ucExt <= 0x5Au);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Reference model: XLEN decoding of MISA.MXL, the two most significant bits of
+ * the register
+ *
+ * @param[in] xMisa       MISA register value
+ * @return  (coreid_xlen) Register width
+ * @date  19.10.2026
+ ******************************************************************************/
+static coreid_xlen eRefGetXlen(hw_reg xMisa)
+{
+  static const coreid_xlen aeXlen[4] = {
+    EN_COREID_XLEN_Unknown, EN_COREID_XLEN_32b,
+    EN_COREID_XLEN_64b,     EN_COREID_XLEN_128b
+  };
+  return aeXlen[(unsigned)(xMisa >> (HW_XLEN - 2))];
+}
+
+/*!****************************************************************************
+ * @brief
+ * Check the module-level invariants for one MISA value
+ *
+ * @param[in] xMisa       MISA register value
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vCheckMisa(hw_reg xMisa)
+{
+  const char cExt = '\0';
+
+  vStub_CSRs_Reset();
+  vStub_CSRs_SetMisa(xMisa);
+  FUZZ_CHECK(eCoreIdGetXlen() == eRefGetXlen(xMisa));
+  FUZZ_CHECK(ulStub_CSRs_GetMisaAccessCount() == 1u);
+
+  vStub_CSRs_Reset();
+  vStub_CSRs_SetMisa(xMisa);
+  ulPresentExtensionCount = 0u;
+  vCoreIdGetPresentExtensions(vRecordExtension);
+  FUZZ_CHECK(ulStub_CSRs_GetMisaAccessCount() == 1u);
+
+  size_t ulExpectedCount = 0u;
+  for (unsigned uBit = 0u; uBit < EXT_NAMES_LUT_LEN; ++uBit)
+  {
+    if ((xMisa >> uBit) & 1u)
+    {
+      FUZZ_CHECK(ulExpectedCount < ulPresentExtensionCount);
+      FUZZ_CHECK(acPresentExtensions[ulExpectedCount] == (char)('A' + uBit));
+      ++ulExpectedCount;
+    }
+  }
+  FUZZ_CHECK(ulPresentExtensionCount == ulExpectedCount);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Check the per-extension invariants for one (MISA, char) pair
+ *
+ * @param[in] xMisa       MISA register value
+ * @param[in] cExt        Extension
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vCheckExtension(hw_reg xMisa, char cExt)
+{
+  const bool bValid = bRefIsExtensionValid(cExt);
+  FUZZ_CHECK(bIsExtensionValid(cExt) == bValid);
+
+  vStub_CSRs_Reset();
+  vStub_CSRs_SetMisa(xMisa);
+  const bool bPresent = bCoreIdIsExtensionPresent(cExt);
+  if (bValid)
+  {
+    FUZZ_CHECK(ulStub_CSRs_GetMisaAccessCount() == 1u);
+    FUZZ_CHECK(bPresent == (bool)((xMisa >> (unsigned)(cExt - 'A')) & 1u));
+  }
+  else
+  {
+    FUZZ_CHECK(ulStub_CSRs_GetMisaAccessCount() == 0u);
+    FUZZ_CHECK(!bPresent);
+  }
+
+  const char* pszName = pszCoreIdGetExtensionName(cExt);
+  if (bValid)
+  {
+    const char* pszRef = apszCoreProfileExtNames[(unsigned)(cExt - 'A')];
+
+    FUZZ_CHECK(pszName == acExtensionNameBuffer);
+    FUZZ_CHECK(strnlen(pszName, EXT_NAME_MAX_LEN) < EXT_NAME_MAX_LEN);
+    FUZZ_CHECK(strcmp(pszName, pszRef) == 0);
+  }
+  else
+  {
+    FUZZ_CHECK(pszName == NULL);
+  }
+}
+
+
+/*- Fuzz target --------------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Fuzz target entry point, called once per input
+ *
+ * @note
+ * Compatible with the libFuzzer interface. The function keeps no state
+ * between calls apart from the stubs, which are reset for every check.
+ *
+ * @param[in] *pubData    Input data
+ * @param[in] ulSize      Input length
+ * @return  (int)       Always 0
+ * @date  19.10.2026
+ ******************************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t* pubData, size_t ulSize)
+{
+  if (ulSize < FUZZ_MISA_LEN) return 0;
+
+  hw_reg xMisa = 0u;
+  for (size_t i = 0u; i < FUZZ_MISA_LEN; ++i)
+  {
+    xMisa |= (hw_reg)pubData[i] << (8u * i);
+  }
+
+  vCheckMisa(xMisa);
+  for (size_t i = FUZZ_MISA_LEN; i < ulSize; ++i)
+  {
+    vCheckExtension(xMisa, (char)pubData[i]);
+  }
+
+  return 0;
+}
+
+
+#ifndef FUZZ_LIBFUZZER
+/*- Built-in persistent driver -----------------------------------------------*/
+#ifndef __AFL_LOOP
+/*!****************************************************************************
+ * @brief
+ * xorshift64* pseudo-random number generator
+ *
+ * @param[inout] *pullState Generator state
+ * @return  (uint64_t)  Next random value
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint64_t ullXorShift(uint64_t* pullState)
+{
+  uint64_t x = *pullState;
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  *pullState = x;
+  return x * 0x2545F4914F6CDD1Dull;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run a single corpus file through the fuzz target
+ *
+ * @param[in] *pszPath    Corpus file path
+ * @param[out] *pubData   Input buffer
+ * @param[in] ulBufSize   Input buffer size
+ * @return  (size_t)    Number of bytes read, truncated to the buffer size
+ * @date  19.10.2026
+ ******************************************************************************/
+static size_t ulRunFile(const char* pszPath, uint8_t* pubData, size_t ulBufSize)
+{
+  FILE* pxFile = fopen(pszPath, "rb");
+  if (pxFile == NULL)
+  {
+    perror(pszPath);
+    exit(EXIT_FAILURE);
+  }
+
+  size_t ulLen = fread(pubData, 1u, ulBufSize, pxFile);
+  fclose(pxFile);
+
+  LLVMFuzzerTestOneInput(pubData, ulLen);
+  return ulLen;
+}
+#endif
+
+/*!****************************************************************************
+ * @brief
+ * Fuzzer main entry point
+ *
+ * Usage: Fuzz_CoreId [-runs=N] [-seed=S] [corpus files...]
+ *
+ * All corpus files are replayed first. Afterwards, N inputs are derived from
+ * the corpus (or from scratch, if none was given) by random mutation and
+ * executed in-process. When built with afl-clang-fast, AFL++ persistent mode
+ * is used instead, with inputs taken from the shared memory test case buffer
+ * (or read from stdin with older AFL++ versions).
+ *
+ * @param[in] argc        Argument count
+ * @param[in] *argv[]     Argument vector
+ * @return  (int)       EXIT_SUCCESS; invariant violations abort()
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(int argc, char* argv[])
+{
+#if defined(__AFL_FUZZ_TESTCASE_LEN)
+  (void)argc; (void)argv;
+  __AFL_INIT();
+  const uint8_t* pubInput = __AFL_FUZZ_TESTCASE_BUF;
+  while (__AFL_LOOP(1000000))
+  {
+    LLVMFuzzerTestOneInput(pubInput, (size_t)__AFL_FUZZ_TESTCASE_LEN);
+  }
+  return EXIT_SUCCESS;
+#elif defined(__AFL_LOOP)
+  (void)argc; (void)argv;
+  static uint8_t aubInput[FUZZ_MAX_INPUT_LEN];
+  while (__AFL_LOOP(1000000))
+  {
+    /* read() instead of stdio, which keeps the EOF flag set between inputs */
+    ssize_t lLen = read(STDIN_FILENO, aubInput, sizeof(aubInput));
+    LLVMFuzzerTestOneInput(aubInput, (lLen > 0) ? (size_t)lLen : 0u);
+  }
+  return EXIT_SUCCESS;
+#else
+  static uint8_t aubCorpus[FUZZ_MAX_CORPUS][FUZZ_MAX_INPUT_LEN];
+  static size_t aulCorpusLen[FUZZ_MAX_CORPUS];
+  size_t ulCorpusCount = 0u;
+  unsigned long ulRuns = FUZZ_DEFAULT_RUNS;
+  uint64_t ullSeed = 0x9E3779B97F4A7C15ull;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strncmp(argv[i], "-runs=", 6u) == 0)
+    {
+      ulRuns = strtoul(&argv[i][6], NULL, 0);
+    }
+    else if (strncmp(argv[i], "-seed=", 6u) == 0)
+    {
+      ullSeed = strtoull(&argv[i][6], NULL, 0) | 1u;
+    }
+    else if (ulCorpusCount < FUZZ_MAX_CORPUS)
+    {
+      aulCorpusLen[ulCorpusCount] =
+        ulRunFile(argv[i], aubCorpus[ulCorpusCount], FUZZ_MAX_INPUT_LEN);
+      ++ulCorpusCount;
+    }
+  }
+  printf("Replayed %zu corpus inputs\n", ulCorpusCount);
+
+  uint8_t aubInput[FUZZ_MAX_INPUT_LEN];
+  struct timespec xStart, xEnd;
+  clock_gettime(CLOCK_MONOTONIC, &xStart);
+
+  for (unsigned long ulRun = 0u; ulRun < ulRuns; ++ulRun)
+  {
+    uint64_t ullRand = ullXorShift(&ullSeed);
+    size_t ulLen;
+
+    if ((ulCorpusCount > 0u) && (ullRand & 1u))
+    {
+      /* Mutate a corpus entry: flip a MISA bit and replace one char */
+      size_t ulIdx = (size_t)((ullRand >> 1) % ulCorpusCount);
+      ulLen = aulCorpusLen[ulIdx];
+      memcpy(aubInput, aubCorpus[ulIdx], ulLen);
+      if (ulLen >= FUZZ_MISA_LEN)
+      {
+        aubInput[(ullRand >> 16) % FUZZ_MISA_LEN] ^=
+          (uint8_t)(1u << ((ullRand >> 19) & 0x7u));
+      }
+      if (ulLen > FUZZ_MISA_LEN)
+      {
+        aubInput[FUZZ_MISA_LEN + ((ullRand >> 24) % (ulLen - FUZZ_MISA_LEN))] =
+          (uint8_t)(ullRand >> 40);
+      }
+    }
+    else
+    {
+      /* Fresh input: random MISA, 1..8 random chars */
+      ulLen = FUZZ_MISA_LEN + 1u + (size_t)((ullRand >> 1) & 0x7u);
+      uint64_t ullBytes = ullXorShift(&ullSeed);
+      memcpy(aubInput, &ullRand, FUZZ_MISA_LEN);
+      memcpy(&aubInput[FUZZ_MISA_LEN], &ullBytes, ulLen - FUZZ_MISA_LEN);
+    }
+
+    LLVMFuzzerTestOneInput(aubInput, ulLen);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &xEnd);
+  double dSeconds = (double)(xEnd.tv_sec - xStart.tv_sec)
+                  + (double)(xEnd.tv_nsec - xStart.tv_nsec) * 1e-9;
+  printf("Done %lu runs in %.3f s (%.0f exec/s)\n",
+         ulRuns, dSeconds, (dSeconds > 0.0) ? (double)ulRuns / dSeconds : 0.0);
+
+  return EXIT_SUCCESS;
+#endif
+}
+#endif /* FUZZ_LIBFUZZER */
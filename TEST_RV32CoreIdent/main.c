@@ -1,6 +1,8 @@
 /*- Header files -------------------------------------------------------------*/
 #include <stdio.h>
+#include <stdlib.h>
 #include <CuTest.h>
+#include "runner.h"
 
 
 /*- Test modules -------------------------------------------------------------*/
@@ -11,13 +13,19 @@ EXTERN_TEST_MODULE(TestCoreId);
  * @brief
  * Test Runner main entry point
  *
+ * See bRunner_ParseArgs() for the command line options.
+ *
+ * @param[in] argc        Argument count
+ * @param[in] *argv[]     Argument vector
  * @return  (int)       Test run result
  * @retval  EXIT_SUCCESS  Test run successful
  * @retval  EXIT_FAILURE  Test run not successful
  * @date  08.05.2023
  ******************************************************************************/
-int main(void)
+int main(int argc, char* argv[])
 {
+  if (!bRunner_ParseArgs(argc, argv)) return EXIT_FAILURE;
+
   BEGIN_TEST_RUN();
   RUN_TEST_MODULE(TestCoreId);
   END_TEST_RUN();
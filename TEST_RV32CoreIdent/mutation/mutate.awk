@@ -0,0 +1,253 @@
+#!/usr/bin/awk -f
+#******************************************************************************
+# mutate.awk
+#
+# Operator and constant mutant generator for C sources
+#
+# Usage:
+#   awk -f mutate.awk -v mode=list source.c
+#       Print all mutation sites, one per line:
+#       <id> TAB <line> TAB <column> TAB <original> TAB <replacement>
+#       TAB <function> TAB <identity>
+#   awk -f mutate.awk -v mode=emit -v id=<id> source.c
+#       Print the source with mutation <id> applied
+#   awk -f mutate.awk -v mode=key -v id=<id> source.c
+#       Print the source with mutation <id> applied, normalized for caching:
+#       comments, blank lines and white space runs are left out.
+#
+# Comments, string literals and #include lines are never mutated. Ids are
+# assigned in source order and only address a site within one version of the
+# source. The identity of a site does not depend on its position: it is made
+# of the enclosing function ("-" at file scope), the original token, the
+# replacement, the normalized source line and the occurrence of this
+# combination within the function.
+#
+# 19.10.2026
+#******************************************************************************
+
+BEGIN {
+  for (i = 32; i < 127; ++i) ORD[sprintf("%c", i)] = i
+
+  # Operator replacement table
+  OP["<="] = "<";   OP[">="] = ">"
+  OP["<"]  = "<=";  OP[">"]  = ">="
+  OP["=="] = "!=";  OP["!="] = "=="
+  OP["&&"] = "||";  OP["||"] = "&&"
+  OP["<<"] = ">>";  OP[">>"] = "<<"
+  OP["+"]  = "-";   OP["-"]  = "+"
+  OP["!!"] = "!"
+
+  # Two-char tokens, checked before single chars
+  split("<= >= == != && || << >> -> ++ -- += -= *= /= |= &= ^= !!", T2, " ")
+  for (k in T2) TOK2[T2[k]] = 1
+
+  inComment = 0
+  siteCount = 0
+  depth = 0
+  func = ""
+}
+
+# Add a mutation site for the current line
+function addSite(col, orig, repl)
+{
+  ++siteCount
+  if (mode == "list")
+  {
+    key = ((func != "") ? func : "-") SUBSEP orig SUBSEP repl SUBSEP normalize(code)
+    printf "%d\t%d\t%d\t%s\t%s\t%s\t%s\n", siteCount, FNR, col, orig, repl,
+           (func != "") ? func : "-", key SUBSEP (++DUP[key])
+  }
+  else if (siteCount == id)
+  {
+    mutLine = FNR; mutCol = col; mutOrig = orig; mutRepl = repl
+  }
+}
+
+# Add integer constant mutations (value +/- 1), keeping base and suffix
+function addNumber(col, tok,    m, digits, suffix, hex, val, fmt)
+{
+  match(tok, /[uUlL]+$/)
+  suffix = (RSTART > 0) ? substr(tok, RSTART) : ""
+  digits = (RSTART > 0) ? substr(tok, 1, RSTART - 1) : tok
+  hex = (digits ~ /^0[xX]/)
+  if (hex) val = strtonum_hex(substr(digits, 3))
+  else if (digits ~ /^[0-9]+$/) val = digits + 0
+  else return
+  fmt = hex ? "0x%X" : "%d"
+  addSite(col, tok, sprintf(fmt, val + 1) suffix)
+  if (val > 0) addSite(col, tok, sprintf(fmt, val - 1) suffix)
+}
+
+# Portable hex conversion (no gawk extensions)
+function strtonum_hex(s,    i, c, v)
+{
+  v = 0
+  s = toupper(s)
+  for (i = 1; i <= length(s); ++i)
+  {
+    c = index("0123456789ABCDEF", substr(s, i, 1)) - 1
+    v = v * 16 + c
+  }
+  return v
+}
+
+# Collapse white space, for position-independent comparison of code
+function normalize(s)
+{
+  gsub(/[ \t]+/, " ", s)
+  sub(/^ /, "", s)
+  sub(/ $/, "", s)
+  return s
+}
+
+# Blank out comments and string literals, keeping column positions.
+# Char literals are kept and recorded in CHARCOL/CHARTOK. The line with
+# only the comments blanked out is left in code.
+function mask(line,    out, i, c, n, q, blank)
+{
+  out = ""
+  code = ""
+  nChars = 0
+  n = length(line)
+  for (i = 1; i <= n; ++i)
+  {
+    c = substr(line, i, 1)
+    if (inComment)
+    {
+      if (substr(line, i, 2) == "*/") { blank = "  "; ++i; inComment = 0 }
+      else blank = " "
+      out = out blank; code = code blank
+    }
+    else if (substr(line, i, 2) == "/*")
+    {
+      out = out "  "; code = code "  "; ++i; inComment = 1
+    }
+    else if (substr(line, i, 2) == "//")
+    {
+      while (i <= n) { out = out " "; code = code " "; ++i }
+    }
+    else if ((c == "\"") || (c == "'"))
+    {
+      q = i
+      out = out " "
+      for (++i; (i <= n) && (substr(line, i, 1) != c); ++i)
+      {
+        if (substr(line, i, 1) == "\\") { out = out " "; ++i }
+        out = out " "
+      }
+      out = out " "
+      code = code substr(line, q, i - q + 1)
+      if ((c == "'") && (i - q == 2))
+      {
+        ++nChars
+        CHARCOL[nChars] = q
+        CHARTOK[nChars] = substr(line, q, 3)
+      }
+    }
+    else { out = out c; code = code c }
+  }
+  return out
+}
+
+# Track the enclosing function definition; sets func, empty at file scope
+function trackScope(masked,    t)
+{
+  if ((func == "") && (depth == 0) && (masked ~ /^[A-Za-z_]/) &&
+      (masked !~ /[;=]/) && match(masked, /[A-Za-z_][A-Za-z_0-9]*[ \t]*\(/))
+  {
+    func = substr(masked, RSTART, RLENGTH - 1)
+    sub(/[ \t]+$/, "", func)
+    inBody = 0
+  }
+  FUNC[FNR] = func
+
+  t = masked
+  depth += gsub(/\{/, "", t)
+  t = masked
+  depth -= gsub(/\}/, "", t)
+  if (depth > 0) inBody = 1
+  else if (inBody) func = ""
+}
+
+{
+  masked = mask($0)
+  trackScope(masked)
+  lines[FNR] = $0
+  codes[FNR] = code
+  if (masked ~ /^[ \t]*#[ \t]*include/) next
+
+  # Walk the tokens of the masked line; char literals are merged in by column
+  n = length(masked)
+  nextChar = 1
+  for (i = 1; i <= n; ++i)
+  {
+    while ((nextChar <= nChars) && (CHARCOL[nextChar] <= i))
+    {
+      ch = substr(CHARTOK[nextChar], 2, 1)
+      if ((ORD[ch] + 1) < 127) addSite(CHARCOL[nextChar], CHARTOK[nextChar], "'" sprintf("%c", ORD[ch] + 1) "'")
+      if ((ORD[ch] - 1) > 32 && (ch != "\\") && (sprintf("%c", ORD[ch] - 1) != "\\") && (sprintf("%c", ORD[ch] - 1) != "'"))
+        addSite(CHARCOL[nextChar], CHARTOK[nextChar], "'" sprintf("%c", ORD[ch] - 1) "'")
+      ++nextChar
+    }
+
+    c = substr(masked, i, 1)
+    if (c ~ /[A-Za-z_]/)
+    {
+      match(substr(masked, i), /^[A-Za-z_0-9]+/)
+      i += RLENGTH - 1
+    }
+    else if (c ~ /[0-9]/)
+    {
+      match(substr(masked, i), /^(0[xX][0-9A-Fa-f]+|[0-9]+)[uUlL]*/)
+      len = RLENGTH
+      if (len > 0)
+      {
+        addNumber(i, substr(masked, i, len))
+        i += len - 1
+      }
+    }
+    else if (substr(masked, i, 2) in TOK2)
+    {
+      t = substr(masked, i, 2)
+      if (t in OP) addSite(i, t, OP[t])
+      ++i
+    }
+    else if (c in OP)
+    {
+      addSite(i, c, OP[c])
+    }
+  }
+}
+
+END {
+  if ((mode == "emit") || (mode == "key"))
+  {
+    if (mutLine == 0)
+    {
+      print "mutate.awk: no mutation with id " id > "/dev/stderr"
+      exit 1
+    }
+  }
+  if (mode == "key")
+  {
+    s = codes[mutLine]
+    codes[mutLine] = substr(s, 1, mutCol - 1) mutRepl substr(s, mutCol + length(mutOrig))
+    for (l = 1; l <= FNR; ++l)
+    {
+      s = normalize(codes[l])
+      if (s != "") print s
+    }
+  }
+  if (mode == "emit")
+  {
+    for (l = 1; l <= FNR; ++l)
+    {
+      if (l == mutLine)
+      {
+        s = lines[l]
+        print substr(s, 1, mutCol - 1) mutRepl substr(s, mutCol + length(mutOrig))
+      }
+      else print lines[l]
+    }
+  }
+}
@@ -0,0 +1,59 @@
+/*!****************************************************************************
+ * @file
+ * CoreProfiles.c
+ *
+ * @brief
+ * Reference profiles of real RISC-V cores
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Header files -------------------------------------------------------------*/
+#include "CoreProfiles.h"
+
+
+/*- Exported variables -------------------------------------------------------*/
+/*! Core profiles                                                             */
+const core_profile axCoreProfiles[CORE_PROFILE_COUNT] = {
+#if HW_XLEN == 32
+  { "CH32V003_RV32EC",      0x40800014u,            EN_COREID_XLEN_32b, "CEX"       },
+  { "CH32V307_RV32IMAFC",   0x40901125u,            EN_COREID_XLEN_32b, "ACFIMUX"   },
+  { "GD32VF103_RV32IMAC",   0x40901105u,            EN_COREID_XLEN_32b, "ACIMUX"    },
+  { "SiFiveE31_RV32IMAC",   0x40101105u,            EN_COREID_XLEN_32b, "ACIMU"     },
+  { "ESP32C3_RV32IMC",      0x40101104u,            EN_COREID_XLEN_32b, "CIMU"      }
+#else
+  { "SiFiveS51_RV64IMAC",   0x8000000000101105ull,  EN_COREID_XLEN_64b, "ACIMU"     },
+  { "SiFiveU54_RV64GC",     0x800000000014112Dull,  EN_COREID_XLEN_64b, "ACDFIMSU"  },
+  { "SiFiveP270_RV64GCV",   0x800000000034112Dull,  EN_COREID_XLEN_64b, "ACDFIMSUV" }
+#endif
+};
+
+/*! Expected extension names, independent from the UUT's lookup table         */
+const char* const apszCoreProfileExtNames[CORE_PROFILE_EXT_COUNT] = {
+  "A - Atomic extension",
+  "B - Bit-Manipulation extension",
+  "C - Compressed extension",
+  "D - Double-precision floating-point extension",
+  "E - RV32E base ISA",
+  "F - Single-precision floating-point extension",
+  "G - Additional standard extensions present",
+  "H - Hypervisor extension",
+  "I - RV32I/RV64I/RV128I base ISA",
+  "J - (reserved)",
+  "K - (reserved)",
+  "L - (reserved)",
+  "M - Integer Multiply/Divide extension",
+  "N - User-level interrupts supported",
+  "O - (reserved)",
+  "P - (reserved)",
+  "Q - Quad-precision floating-point extension",
+  "R - (reserved)",
+  "S - Supervisor mode implemented",
+  "T - (reserved)",
+  "U - User mode implemented",
+  "V - Vector extension",
+  "W - (reserved)",
+  "X - Non-standard extensions present",
+  "Y - (reserved)",
+  "Z - (reserved)"
+};
@@ -0,0 +1,54 @@
+/*!****************************************************************************
+ * @file
+ * CoreProfiles.h
+ *
+ * @brief
+ * Reference profiles of real RISC-V cores
+ *
+ * Each profile holds the MISA value read from a real core together with the
+ * results the "Core ID" API is expected to produce for it. The profiles are
+ * used as the parameter table of the profile test group, so adding a core
+ * only needs a new table entry. Only the cores matching the simulated
+ * register width of the test build are included.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef PROFILES_COREPROFILES_H_
+#define PROFILES_COREPROFILES_H_
+
+/*- Header files -------------------------------------------------------------*/
+#include <stddef.h>
+#include <stdint.h>
+#include "hw_layer.h"
+#include "../../FW_RV32CoreIdent/coreid.h"
+
+
+/*- Macros -------------------------------------------------------------------*/
+/*! Number of core profiles of the simulated register width                   */
+#if HW_XLEN == 32
+#define CORE_PROFILE_COUNT        (5u)
+#else
+#define CORE_PROFILE_COUNT        (3u)
+#endif
+
+/*! Number of extension letters                                               */
+#define CORE_PROFILE_EXT_COUNT    ((size_t)('Z' - 'A') + 1u)
+
+
+/*- Type definitions ---------------------------------------------------------*/
+/*! Core profile                                                              */
+typedef struct
+{
+  const char* pszName;                /*!< Core name (first member)           */
+  uint64_t ullMisa;                   /*!< MISA CSR value                     */
+  coreid_xlen eXlen;                  /*!< Expected register width            */
+  const char* pszExtensions;          /*!< Expected extensions, A to Z        */
+} core_profile;
+
+
+/*- Exported variables -------------------------------------------------------*/
+extern const core_profile axCoreProfiles[CORE_PROFILE_COUNT];
+extern const char* const apszCoreProfileExtNames[CORE_PROFILE_EXT_COUNT];
+
+#endif /* PROFILES_COREPROFILES_H_ */
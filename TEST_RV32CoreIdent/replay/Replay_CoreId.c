@@ -0,0 +1,281 @@
+/*!****************************************************************************
+ * @file
+ * Replay_CoreId.c
+ *
+ * @brief
+ * CSR capture replay for the "Core ID" unit under test
+ *
+ * Every capture file given on the command line is mapped by the CSR stub and
+ * the firmware's identification sequence (vIdentifyCore()) is run against it.
+ * A capture passes, if the sequence reads the CSRs exactly in the recorded
+ * order and its results match the reference: the MISA value of the first
+ * record, decoded independently of the UUT, and the core profile with that
+ * MISA value, if any. The first divergence or mismatch of every failing
+ * capture is reported.
+ *
+ * With -record=FILE, the identification sequence is instead run against the
+ * MISA value given by -misa=VALUE and recorded into a new capture file.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Header files -------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "coreid.h"
+#include "identify.h"
+
+
+/*- Stubs --------------------------------------------------------------------*/
+#include "Stub_CSRs.h"
+
+
+/*- Test data ----------------------------------------------------------------*/
+#include "CoreProfiles.h"
+
+
+/*- Macros -------------------------------------------------------------------*/
+/*! Maximum length of a mismatch report                                       */
+#define REPLAY_MSG_LEN            (160u)
+
+/*! Mask of the extension bits of MISA                                        */
+#define REPLAY_EXT_MSK            ((UINT32_C(1) << CORE_PROFILE_EXT_COUNT) - 1u)
+
+
+/*- Private variables --------------------------------------------------------*/
+/*! First mismatch of the capture being replayed, empty if none               */
+static char acMismatch[REPLAY_MSG_LEN];
+
+
+/*- Private functions --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Check an extension name against the reference table
+ *
+ * @param[in] cExt        Extension letter
+ * @param[in] *pszName    Name returned by the UUT
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vCheckName(char cExt, const char* pszName)
+{
+  const char* pszRef = apszCoreProfileExtNames[(unsigned)(cExt - 'A')];
+
+  if ((acMismatch[0] == '\0') && ((pszName == NULL) || (strcmp(pszName, pszRef) != 0)))
+  {
+    snprintf(acMismatch, sizeof(acMismatch), "name of '%c' is \"%s\", expected \"%s\"",
+             cExt, (pszName != NULL) ? pszName : "(null)", pszRef);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Report a mismatch of an extension mask
+ *
+ * @param[in] *pszWhat    Mask description
+ * @param[in] ulActual    Extension mask
+ * @param[in] ulExpected  Expected extension mask
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vCheckMask(const char* pszWhat, uint32_t ulActual, uint32_t ulExpected)
+{
+  if ((acMismatch[0] == '\0') && (ulActual != ulExpected))
+  {
+    snprintf(acMismatch, sizeof(acMismatch), "%s 0x%07lx, expected 0x%07lx",
+             pszWhat, (unsigned long)ulActual, (unsigned long)ulExpected);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Cross-check the identification results against the decoded MISA value
+ *
+ * The reference is decoded here, independently of the UUT. If a core profile
+ * has the same MISA value, its expectations need to agree as well.
+ *
+ * @param[in] *pxResult   Identification results
+ * @param[in] ullMisa     MISA value of the first capture record
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vCrossCheck(const identify_result* pxResult, uint64_t ullMisa)
+{
+  static const coreid_xlen aeXlen[4] = {
+    EN_COREID_XLEN_Unknown, EN_COREID_XLEN_32b, EN_COREID_XLEN_64b, EN_COREID_XLEN_128b
+  };
+  coreid_xlen eXlen = aeXlen[(ullMisa >> (HW_XLEN - 2)) & 0x3u];
+  uint32_t ulExtensions = (uint32_t)ullMisa & REPLAY_EXT_MSK;
+
+  if ((acMismatch[0] == '\0') && (pxResult->eXlen != eXlen))
+  {
+    snprintf(acMismatch, sizeof(acMismatch), "XLEN %d, expected %d",
+             (int)pxResult->eXlen, (int)eXlen);
+  }
+  vCheckMask("extensions present", pxResult->ulPresent, ulExtensions);
+  vCheckMask("extensions listed", pxResult->ulListed, ulExtensions);
+
+  for (size_t i = 0u; i < CORE_PROFILE_COUNT; ++i)
+  {
+    const core_profile* pxProfile = &axCoreProfiles[i];
+    if (pxProfile->ullMisa != ullMisa) continue;
+
+    uint32_t ulProfileExt = 0u;
+    for (const char* pc = pxProfile->pszExtensions; *pc != '\0'; ++pc)
+    {
+      ulProfileExt |= IDENTIFY_EXT_BIT(*pc);
+    }
+    if ((acMismatch[0] == '\0') && (pxProfile->eXlen != eXlen))
+    {
+      snprintf(acMismatch, sizeof(acMismatch), "profile %s: XLEN %d, decoded %d",
+               pxProfile->pszName, (int)pxProfile->eXlen, (int)eXlen);
+    }
+    vCheckMask(pxProfile->pszName, ulProfileExt, ulExtensions);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get the MISA value of the first MISA record of the replayed capture
+ *
+ * @param[out] *pullMisa  MISA value, truncated to the register width
+ * @return  (bool)      true, if the capture has a MISA record
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool bGetCaptureMisa(uint64_t* pullMisa)
+{
+  csr_trace_record xRecord;
+
+  for (uint32_t i = 0u; bStub_CSRs_ReplayGetRecord(i, &xRecord); ++i)
+  {
+    if (xRecord.uwCsr != CSR_TRACE_ID_MISA) continue;
+    *pullMisa = (uint64_t)(hw_reg)xRecord.ullValue;
+    return true;
+  }
+  return false;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Record the identification sequence into a capture file
+ *
+ * @param[in] *pszFile    Capture file name
+ * @param[in] ullMisa     MISA register value
+ * @return  (int)       Exit code
+ * @date  19.10.2026
+ ******************************************************************************/
+static int iRecord(const char* pszFile, uint64_t ullMisa)
+{
+  identify_result xResult;
+
+  vStub_CSRs_Reset();
+  vStub_CSRs_SetMisa(ullMisa);
+  if (!bStub_CSRs_RecordStart(pszFile))
+  {
+    perror(pszFile);
+    return EXIT_FAILURE;
+  }
+  vIdentifyCore(&xResult, NULL);
+  if (!bStub_CSRs_RecordStop())
+  {
+    perror(pszFile);
+    return EXIT_FAILURE;
+  }
+
+  printf("%s: recorded %lu accesses\n", pszFile,
+         (unsigned long)ulStub_CSRs_GetMisaAccessCount());
+  return EXIT_SUCCESS;
+}
+
+
+/*- Main program -------------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Capture replay entry point
+ *
+ * @param[in] argc        Argument count
+ * @param[in] *argv[]     Argument vector
+ * @return  (int)       EXIT_SUCCESS, if all captures passed
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(int argc, char* argv[])
+{
+  const char* pszRecordFile = NULL;
+  uint64_t ullMisa = 0u;
+  int iFirstCapture = argc;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strncmp(argv[i], "-record=", 8u) == 0)
+    {
+      pszRecordFile = &argv[i][8];
+    }
+    else if (strncmp(argv[i], "-misa=", 6u) == 0)
+    {
+      ullMisa = strtoull(&argv[i][6], NULL, 0);
+    }
+    else if (argv[i][0] != '-')
+    {
+      iFirstCapture = i;
+      break;
+    }
+    else
+    {
+      fprintf(stderr, "Usage: %s CAPTURE...\n"
+                      "       %s -record=FILE -misa=VALUE\n", argv[0], argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (pszRecordFile != NULL) return iRecord(pszRecordFile, ullMisa);
+
+  unsigned long ulCaptures = 0u;
+  unsigned long ulInvalid = 0u;
+  unsigned long ulDiverged = 0u;
+  unsigned long ulMismatched = 0u;
+  identify_result xResult;
+  uint64_t ullCaptureMisa;
+  struct timespec xStart, xEnd;
+  clock_gettime(CLOCK_MONOTONIC, &xStart);
+
+  for (int i = iFirstCapture; i < argc; ++i)
+  {
+    ++ulCaptures;
+    vStub_CSRs_Reset();
+    if (!bStub_CSRs_ReplayStart(argv[i]) || !bGetCaptureMisa(&ullCaptureMisa))
+    {
+      ++ulInvalid;
+      printf("INVALID  %s\n", argv[i]);
+      continue;
+    }
+
+    acMismatch[0] = '\0';
+    vIdentifyCore(&xResult, vCheckName);
+
+    const char* pszDivergence = pszStub_CSRs_ReplayCheck();
+    if (pszDivergence != NULL)
+    {
+      ++ulDiverged;
+      printf("DIVERGED %s: %s\n", argv[i], pszDivergence);
+      continue;
+    }
+
+    vCrossCheck(&xResult, ullCaptureMisa);
+    if (acMismatch[0] != '\0')
+    {
+      ++ulMismatched;
+      printf("MISMATCH %s: %s\n", argv[i], acMismatch);
+    }
+  }
+  vStub_CSRs_Reset();
+
+  clock_gettime(CLOCK_MONOTONIC, &xEnd);
+  double dSeconds = (double)(xEnd.tv_sec - xStart.tv_sec) +
+                    (double)(xEnd.tv_nsec - xStart.tv_nsec) * 1e-9;
+  unsigned long ulFailed = ulDiverged + ulMismatched + ulInvalid;
+  printf("Replayed %lu captures: %lu passed, %lu diverged, %lu mismatched, %lu invalid "
+         "(%.3f ms, %.0f captures/s)\n",
+         ulCaptures, ulCaptures - ulFailed, ulDiverged, ulMismatched, ulInvalid,
+         dSeconds * 1e3, (dSeconds > 0.0) ? (double)ulCaptures / dSeconds : 0.0);
+
+  return (ulFailed == 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,353 @@
+/*!****************************************************************************
+ * @file
+ * Stress_CoreId.c
+ *
+ * @brief
+ * Concurrency stress suite for the "Core ID" unit under test
+ *
+ * A number of threads call every exported function of the module at the same
+ * time, each thread using a different set of extension chars, and validate
+ * every result against values recorded single-threaded beforehand. The run is
+ * repeated for a growing number of threads in order to report throughput.
+ *
+ * The MISA value may be taken from the first record of a CSR capture file
+ * (-capture=FILE), in order to benchmark against a real device.
+ *
+ * Intended to be built with -fsanitize=thread ("make stress").
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Header files -------------------------------------------------------------*/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "coreid.h"
+
+
+/*- Stubs --------------------------------------------------------------------*/
+#include "Stub_CSRs.h"
+
+
+/*- Macros -------------------------------------------------------------------*/
+/*! Number of queried extension chars, including invalid ones                 */
+#define STRESS_EXT_COUNT            (28u)
+
+/*! Maximum length of a recorded extension name                               */
+#define STRESS_NAME_MAX_LEN         (64u)
+
+/*! Upper limit for the number of threads                                     */
+#define STRESS_MAX_THREADS          (64u)
+
+/*! Default number of API call rounds per thread                              */
+#define STRESS_DEFAULT_ROUNDS       (200000ul)
+
+/*! MISA value used for the stress run (RV32IMAC)                             */
+#define STRESS_MISA                 (0x40001105u)
+
+
+/*- Type definitions ---------------------------------------------------------*/
+/*! Exported functions under test                                             */
+typedef enum
+{
+  EN_STRESS_FN_GetXlen,
+  EN_STRESS_FN_IsExtensionPresent,
+  EN_STRESS_FN_GetExtensionName,
+  EN_STRESS_FN_GetPresentExtensions,
+  EN_STRESS_FN_Count
+} stress_fn;
+
+/*! Per-thread context                                                        */
+typedef struct
+{
+  pthread_t xThread;                  /*!< Thread handle                      */
+  unsigned uIndex;                    /*!< Thread index                       */
+  unsigned long ulRounds;             /*!< Number of call rounds              */
+  unsigned long aulErrors[EN_STRESS_FN_Count]; /*!< Failed validations        */
+  char acFirstError[128];             /*!< First failed validation            */
+} stress_thread;
+
+
+/*- Private variables --------------------------------------------------------*/
+/*! Names of the functions under test, indexed by stress_fn                   */
+static const char* const apszFunctionNames[EN_STRESS_FN_Count] = {
+  "eCoreIdGetXlen",
+  "bCoreIdIsExtensionPresent",
+  "pszCoreIdGetExtensionName",
+  "vCoreIdGetPresentExtensions"
+};
+
+/*! Queried extension chars: all letters plus two invalid chars               */
+static const char acExtensions[STRESS_EXT_COUNT] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZa@";
+
+/*! Expected results, recorded single-threaded before the run                 */
+static coreid_xlen eExpectedXlen;
+static bool abExpectedPresent[STRESS_EXT_COUNT];
+static char aacExpectedName[STRESS_EXT_COUNT][STRESS_NAME_MAX_LEN];
+static bool abExpectedNameNull[STRESS_EXT_COUNT];
+static char acExpectedPresentList[STRESS_EXT_COUNT];
+
+/*! Start barrier for all worker threads                                      */
+static pthread_barrier_t xStartBarrier;
+
+/*! Per-thread list of reported extensions                                    */
+static __thread char acPresentList[STRESS_EXT_COUNT];
+static __thread unsigned uPresentCount;
+
+
+/*- Private functions --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Extension callback, records into the calling thread's list
+ *
+ * @param[in] cExt        Extension
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vRecordExtension(char cExt)
+{
+  if (uPresentCount < STRESS_EXT_COUNT - 1u) acPresentList[uPresentCount] = cExt;
+  ++uPresentCount;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Record the expected results of every function, single-threaded
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vRecordExpected(void)
+{
+  eExpectedXlen = eCoreIdGetXlen();
+
+  for (unsigned i = 0u; i < STRESS_EXT_COUNT; ++i)
+  {
+    abExpectedPresent[i] = bCoreIdIsExtensionPresent(acExtensions[i]);
+
+    const char* pszName = pszCoreIdGetExtensionName(acExtensions[i]);
+    abExpectedNameNull[i] = (pszName == NULL);
+    if (pszName != NULL)
+    {
+      strncpy(aacExpectedName[i], pszName, STRESS_NAME_MAX_LEN - 1u);
+    }
+  }
+
+  uPresentCount = 0u;
+  memset(acPresentList, 0, sizeof(acPresentList));
+  vCoreIdGetPresentExtensions(vRecordExtension);
+  memcpy(acExpectedPresentList, acPresentList, sizeof(acPresentList));
+}
+
+/*!****************************************************************************
+ * @brief
+ * Count a failed validation and keep a description of the first one
+ *
+ * @param[inout] *pxCtx   Thread context
+ * @param[in] eFn         Failing function
+ * @param[in] cExt        Queried extension
+ * @param[in] *pszActual  Actual result (may be NULL)
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vReportError(stress_thread* pxCtx, stress_fn eFn, char cExt,
+                         const char* pszActual)
+{
+  if (pxCtx->aulErrors[eFn]++ == 0u && pxCtx->acFirstError[0] == '\0')
+  {
+    snprintf(pxCtx->acFirstError, sizeof(pxCtx->acFirstError),
+             "%s('%c') returned \"%.64s\"", apszFunctionNames[eFn],
+             cExt, (pszActual != NULL) ? pszActual : "NULL");
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Worker thread: call every exported function and validate the results
+ *
+ * @param[inout] *pvArg   Thread context (stress_thread)
+ * @return  (void*)     NULL
+ * @date  19.10.2026
+ ******************************************************************************/
+static void* pvWorker(void* pvArg)
+{
+  stress_thread* pxCtx = pvArg;
+  pthread_barrier_wait(&xStartBarrier);
+
+  for (unsigned long ulRound = 0u; ulRound < pxCtx->ulRounds; ++ulRound)
+  {
+    /* Every thread walks the extension list from a different offset */
+    unsigned uIdx = (unsigned)((pxCtx->uIndex * 7u + ulRound) % STRESS_EXT_COUNT);
+    char cExt = acExtensions[uIdx];
+
+    if (eCoreIdGetXlen() != eExpectedXlen)
+    {
+      vReportError(pxCtx, EN_STRESS_FN_GetXlen, cExt, NULL);
+    }
+
+    if (bCoreIdIsExtensionPresent(cExt) != abExpectedPresent[uIdx])
+    {
+      vReportError(pxCtx, EN_STRESS_FN_IsExtensionPresent, cExt, NULL);
+    }
+
+    const char* pszName = pszCoreIdGetExtensionName(cExt);
+    if (abExpectedNameNull[uIdx] ? (pszName != NULL)
+        : ((pszName == NULL) || (strcmp(pszName, aacExpectedName[uIdx]) != 0)))
+    {
+      vReportError(pxCtx, EN_STRESS_FN_GetExtensionName, cExt, pszName);
+    }
+
+    uPresentCount = 0u;
+    memset(acPresentList, 0, sizeof(acPresentList));
+    vCoreIdGetPresentExtensions(vRecordExtension);
+    if (memcmp(acPresentList, acExpectedPresentList, sizeof(acPresentList)) != 0)
+    {
+      vReportError(pxCtx, EN_STRESS_FN_GetPresentExtensions, cExt, acPresentList);
+    }
+  }
+
+  return NULL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run all workers once with the given thread count
+ *
+ * @param[inout] *axCtx   Thread contexts (at least uThreads entries)
+ * @param[in] uThreads    Number of threads
+ * @param[in] ulRounds    Number of call rounds per thread
+ * @return  (unsigned long) Total number of failed validations
+ * @date  19.10.2026
+ ******************************************************************************/
+static unsigned long ulRunStress(stress_thread* axCtx, unsigned uThreads,
+                                 unsigned long ulRounds)
+{
+  struct timespec xStart, xEnd;
+  unsigned long aulErrors[EN_STRESS_FN_Count] = { 0u };
+  unsigned long ulTotalErrors = 0u;
+
+  pthread_barrier_init(&xStartBarrier, NULL, uThreads + 1u);
+  for (unsigned i = 0u; i < uThreads; ++i)
+  {
+    memset(&axCtx[i], 0, sizeof(axCtx[i]));
+    axCtx[i].uIndex = i;
+    axCtx[i].ulRounds = ulRounds;
+    if (pthread_create(&axCtx[i].xThread, NULL, pvWorker, &axCtx[i]) != 0)
+    {
+      perror("pthread_create");
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &xStart);
+  pthread_barrier_wait(&xStartBarrier);
+  for (unsigned i = 0u; i < uThreads; ++i) pthread_join(axCtx[i].xThread, NULL);
+  clock_gettime(CLOCK_MONOTONIC, &xEnd);
+  pthread_barrier_destroy(&xStartBarrier);
+
+  for (unsigned i = 0u; i < uThreads; ++i)
+  {
+    for (unsigned f = 0u; f < EN_STRESS_FN_Count; ++f)
+    {
+      aulErrors[f] += axCtx[i].aulErrors[f];
+      ulTotalErrors += axCtx[i].aulErrors[f];
+    }
+  }
+
+  double dSeconds = (double)(xEnd.tv_sec - xStart.tv_sec)
+                  + (double)(xEnd.tv_nsec - xStart.tv_nsec) * 1e-9;
+  double dCalls = (double)uThreads * (double)ulRounds * EN_STRESS_FN_Count;
+  printf("%7u  %12.0f  %10.3f  %13.2f  %9lu\n", uThreads, dCalls, dSeconds,
+         (dSeconds > 0.0) ? dCalls / dSeconds * 1e-6 : 0.0, ulTotalErrors);
+
+  for (unsigned f = 0u; f < EN_STRESS_FN_Count; ++f)
+  {
+    if (aulErrors[f] == 0u) continue;
+    printf("         %-28s %lu failed validations\n", apszFunctionNames[f], aulErrors[f]);
+  }
+  for (unsigned i = 0u; i < uThreads; ++i)
+  {
+    if (axCtx[i].acFirstError[0] == '\0') continue;
+    printf("         thread %u: first failure: %s\n", i, axCtx[i].acFirstError);
+    break;
+  }
+
+  return ulTotalErrors;
+}
+
+
+/*- Main entry point ---------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Stress suite main entry point
+ *
+ * Usage: Stress_CoreId [-threads=N] [-rounds=N] [-capture=FILE]
+ *
+ * The suite runs with 1, 2, 4, ... threads up to the maximum (default: number
+ * of online CPUs, at least 2). With -capture=FILE, the MISA value is taken
+ * from the first record of the capture; further records are ignored.
+ *
+ * @param[in] argc        Argument count
+ * @param[in] *argv[]     Argument vector
+ * @return  (int)       Stress run result
+ * @retval  EXIT_SUCCESS  All results valid
+ * @retval  EXIT_FAILURE  At least one result was invalid
+ * @date  19.10.2026
+ ******************************************************************************/
+int main(int argc, char* argv[])
+{
+  static stress_thread axCtx[STRESS_MAX_THREADS];
+  long lCpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned uMaxThreads = (lCpus > 2) ? (unsigned)lCpus : 2u;
+  unsigned long ulRounds = STRESS_DEFAULT_ROUNDS;
+  unsigned long ulErrors = 0u;
+  uint64_t ullMisa = STRESS_MISA;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (strncmp(argv[i], "-threads=", 9u) == 0)
+    {
+      uMaxThreads = (unsigned)strtoul(&argv[i][9], NULL, 0);
+    }
+    else if (strncmp(argv[i], "-rounds=", 8u) == 0)
+    {
+      ulRounds = strtoul(&argv[i][8], NULL, 0);
+    }
+    else if (strncmp(argv[i], "-capture=", 9u) == 0)
+    {
+      vStub_CSRs_Reset();
+      if (!bStub_CSRs_ReplayStart(&argv[i][9]))
+      {
+        fprintf(stderr, "%s: invalid capture file\n", &argv[i][9]);
+        return EXIT_FAILURE;
+      }
+      ullMisa = ullStub_CSRs_GetMisa64();
+      vStub_CSRs_ReplayStop();
+    }
+    else
+    {
+      fprintf(stderr, "Usage: %s [-threads=N] [-rounds=N] [-capture=FILE]\n"
+                      "  -capture=FILE  Use the MISA value of the first capture record\n",
+              argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (uMaxThreads < 1u) uMaxThreads = 1u;
+  if (uMaxThreads > STRESS_MAX_THREADS) uMaxThreads = STRESS_MAX_THREADS;
+
+  vStub_CSRs_Reset();
+  vStub_CSRs_SetMisa(ullMisa);
+  vRecordExpected();
+
+  printf("MISA 0x%016llx\n", (unsigned long long)ullMisa);
+  printf("Threads         Calls    Time [s]  Rate [Mcall/s]     Errors\n");
+  for (unsigned uThreads = 1u; ; uThreads *= 2u)
+  {
+    if (uThreads > uMaxThreads) uThreads = uMaxThreads;
+    ulErrors += ulRunStress(axCtx, uThreads, ulRounds);
+    if (uThreads == uMaxThreads) break;
+  }
+
+  return (ulErrors == 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
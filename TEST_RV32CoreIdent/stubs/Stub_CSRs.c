@@ -9,40 +9,125 @@
  ******************************************************************************/
 
 /*- Header files -------------------------------------------------------------*/
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "Stub_CSRs.h"
 
 
+/*- Macros -------------------------------------------------------------------*/
+/*! Maximum length of a replay divergence report                              */
+#define STUB_REPLAY_MSG_LEN       (160u)
+
+
 /*- Private variables --------------------------------------------------------*/
-/*! MISA register value                                                       */
-static uint32_t ulMisaValue;
+/*! MISA register value, truncated on 32-bit reads                            */
+static uint64_t ullMisaValue;
 
 /*! Access counter                                                            */
 static uint32_t ulMisaAccessCount;
 
+/*! Capture being recorded                                                    */
+static FILE* pxRecordFile;
+static uint32_t ulRecordCount;
+
+/*! Capture being replayed, mapped into memory                                */
+static void* pvReplayMap;
+static size_t ulReplayMapLen;
+static const csr_trace_record* pxReplayRecords;
+static uint32_t ulReplayCount;
+static uint32_t ulReplayNext;
+
+/*! First replay divergence, empty if none                                    */
+static char acReplayMsg[STUB_REPLAY_MSG_LEN];
+
+
+/*- Private functions --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Serve a CSR read access
+ *
+ * In replay mode, the value is taken from the next record of the capture
+ * instead of the assigned value. Once the accesses diverge from the capture,
+ * reads return 0. The value is truncated to the access width and, if enabled,
+ * recorded into the capture file as served.
+ *
+ * @param[in] uwCsr       CSR address
+ * @param[in] ullValue    Assigned CSR value
+ * @param[in] uWidth      Access width in bits, 32 or 64
+ * @return  (uint64_t)  CSR value
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint64_t ullReadCsr(uint16_t uwCsr, uint64_t ullValue, unsigned uWidth)
+{
+  if (pvReplayMap != NULL)
+  {
+    if (acReplayMsg[0] != '\0') return 0u;
+
+    if (ulReplayNext >= ulReplayCount)
+    {
+      snprintf(acReplayMsg, sizeof(acReplayMsg),
+               "access %lu: read of CSR 0x%03x beyond the end of the capture",
+               (unsigned long)ulReplayNext, (unsigned)uwCsr);
+      return 0u;
+    }
+
+    const csr_trace_record* pxRecord = &pxReplayRecords[ulReplayNext];
+    if (pxRecord->uwCsr != uwCsr)
+    {
+      snprintf(acReplayMsg, sizeof(acReplayMsg),
+               "access %lu (order %lu): read of CSR 0x%03x, recorded CSR 0x%03x",
+               (unsigned long)ulReplayNext, (unsigned long)pxRecord->ulOrder,
+               (unsigned)uwCsr, (unsigned)pxRecord->uwCsr);
+      return 0u;
+    }
+
+    ++ulReplayNext;
+    ullValue = pxRecord->ullValue;
+  }
+
+  if (uWidth < 64u) ullValue &= (UINT64_C(1) << uWidth) - 1u;
+
+  if (pxRecordFile != NULL)
+  {
+    csr_trace_record xRecord = { ullValue, ulRecordCount++, uwCsr, 0u };
+    fwrite(&xRecord, sizeof(xRecord), 1u, pxRecordFile);
+  }
+
+  return ullValue;
+}
+
 
 /*- Access functions ---------------------------------------------------------*/
 /*!****************************************************************************
  * @brief
  * Reset test environment
  *
+ * @note Stops any capture recording or replay.
+ *
  * @date  29.05.2023
  ******************************************************************************/
 void vStub_CSRs_Reset(void)
 {
-  ulMisaValue = 0u; // invalid MXL encoding
+  ullMisaValue = 0u; // invalid MXL encoding
   ulMisaAccessCount = 0u;
+  bStub_CSRs_RecordStop();
+  vStub_CSRs_ReplayStop();
 }
 
 /*!****************************************************************************
  * @brief
  * Set MISA register value
  *
- * @param[in] ulValue     MISA Register value
+ * @param[in] ullValue    MISA Register value
  * @date  29.05.2023
  ******************************************************************************/
-void vStub_CSRs_SetMisa(uint32_t ulValue)
+void vStub_CSRs_SetMisa(uint64_t ullValue)
 {
-  ulMisaValue = ulValue;
+  ullMisaValue = ullValue;
 }
 
 /*!****************************************************************************
@@ -54,20 +139,201 @@ void vStub_CSRs_SetMisa(uint32_t ulValue)
  ******************************************************************************/
 uint32_t ulStub_CSRs_GetMisaAccessCount(void)
 {
-  return ulMisaAccessCount;
+  return __atomic_load_n(&ulMisaAccessCount, __ATOMIC_RELAXED);
 }
 
 /*!****************************************************************************
  * @brief
- * Retrieve MISA register value
+ * Retrieve MISA register value of a 32-bit core
  *
  * @note This function simulates a "csrr" read access to the MISA CSR.
  *
- * @return  (uint32_t)  Assigned MISA value
+ * @note The access counter is updated atomically, so the stub may be used by
+ * the concurrency stress suite without adding races of its own.
+ *
+ * @return  (uint32_t)  Assigned MISA value, lower 32 bits
  * @date  29.05.2023
  ******************************************************************************/
-uint32_t ulStub_CSRs_GetMisa(void)
+uint32_t ulStub_CSRs_GetMisa32(void)
+{
+  __atomic_fetch_add(&ulMisaAccessCount, 1u, __ATOMIC_RELAXED);
+  return (uint32_t)ullReadCsr(CSR_TRACE_ID_MISA, ullMisaValue, 32u);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Retrieve MISA register value of a 64-bit core
+ *
+ * @note This function simulates a "csrr" read access to the MISA CSR.
+ *
+ * @return  (uint64_t)  Assigned MISA value
+ * @date  19.10.2026
+ ******************************************************************************/
+uint64_t ullStub_CSRs_GetMisa64(void)
+{
+  __atomic_fetch_add(&ulMisaAccessCount, 1u, __ATOMIC_RELAXED);
+  return ullReadCsr(CSR_TRACE_ID_MISA, ullMisaValue, 64u);
+}
+
+
+/*- Capture record/replay functions ------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Start recording all CSR read accesses into a capture file
+ *
+ * @param[in] *pszFile    Capture file name
+ * @return  (bool)      true, if the capture file was created
+ * @date  19.10.2026
+ ******************************************************************************/
+bool bStub_CSRs_RecordStart(const char* pszFile)
+{
+  bStub_CSRs_RecordStop();
+
+  pxRecordFile = fopen(pszFile, "wb");
+  if (pxRecordFile == NULL) return false;
+
+  /* Header is rewritten with the final record count on stop */
+  csr_trace_header xHeader = {
+    CSR_TRACE_MAGIC, CSR_TRACE_VERSION, HW_XLEN, sizeof(csr_trace_record), 0u, 0u
+  };
+  ulRecordCount = 0u;
+  return fwrite(&xHeader, sizeof(xHeader), 1u, pxRecordFile) == 1u;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Stop recording and finish the capture file
+ *
+ * @return  (bool)      true, if the capture file was written completely
+ * @date  19.10.2026
+ ******************************************************************************/
+bool bStub_CSRs_RecordStop(void)
+{
+  if (pxRecordFile == NULL) return true;
+
+  csr_trace_header xHeader = {
+    CSR_TRACE_MAGIC, CSR_TRACE_VERSION, HW_XLEN, sizeof(csr_trace_record),
+    ulRecordCount, 0u
+  };
+  bool bOk = (fseek(pxRecordFile, 0L, SEEK_SET) == 0) &&
+             (fwrite(&xHeader, sizeof(xHeader), 1u, pxRecordFile) == 1u);
+  bOk = (fclose(pxRecordFile) == 0) && bOk;
+  pxRecordFile = NULL;
+  return bOk;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Start serving CSR read accesses from a capture file
+ *
+ * The capture is mapped into memory and its records are served in place. The
+ * capture needs to match the simulated register width, and its access order
+ * numbers need to be strictly increasing.
+ *
+ * @param[in] *pszFile    Capture file name
+ * @return  (bool)      true, if the capture is valid
+ * @date  19.10.2026
+ ******************************************************************************/
+bool bStub_CSRs_ReplayStart(const char* pszFile)
+{
+  struct stat xStat;
+
+  vStub_CSRs_ReplayStop();
+
+  int iFd = open(pszFile, O_RDONLY);
+  if (iFd < 0) return false;
+  if ((fstat(iFd, &xStat) != 0) || ((size_t)xStat.st_size < sizeof(csr_trace_header)))
+  {
+    close(iFd);
+    return false;
+  }
+
+  void* pvMap = mmap(NULL, (size_t)xStat.st_size, PROT_READ, MAP_PRIVATE, iFd, 0);
+  close(iFd);
+  if (pvMap == MAP_FAILED) return false;
+
+  const csr_trace_header* pxHeader = pvMap;
+  const csr_trace_record* pxRecords = (const csr_trace_record*)(pxHeader + 1);
+  size_t ulMaxCount = ((size_t)xStat.st_size - sizeof(*pxHeader)) / sizeof(*pxRecords);
+
+  bool bValid = (pxHeader->ulMagic == CSR_TRACE_MAGIC) &&
+                (pxHeader->ubVersion == CSR_TRACE_VERSION) &&
+                (pxHeader->ubXlen == HW_XLEN) &&
+                (pxHeader->uwRecordSize == sizeof(*pxRecords)) &&
+                (pxHeader->ulRecordCount <= ulMaxCount);
+  for (uint32_t i = 1u; bValid && (i < pxHeader->ulRecordCount); ++i)
+  {
+    bValid = (pxRecords[i].ulOrder > pxRecords[i - 1u].ulOrder);
+  }
+  if (!bValid)
+  {
+    munmap(pvMap, (size_t)xStat.st_size);
+    return false;
+  }
+
+  pvReplayMap = pvMap;
+  ulReplayMapLen = (size_t)xStat.st_size;
+  pxReplayRecords = pxRecords;
+  ulReplayCount = pxHeader->ulRecordCount;
+  ulReplayNext = 0u;
+  acReplayMsg[0] = '\0';
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Stop replaying and unmap the capture file
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void vStub_CSRs_ReplayStop(void)
+{
+  if (pvReplayMap != NULL) munmap(pvReplayMap, ulReplayMapLen);
+  pvReplayMap = NULL;
+  ulReplayMapLen = 0u;
+  pxReplayRecords = NULL;
+  ulReplayCount = 0u;
+  ulReplayNext = 0u;
+  acReplayMsg[0] = '\0';
+}
+
+/*!****************************************************************************
+ * @brief
+ * Retrieve a record of the replayed capture
+ *
+ * @param[in] ulIndex     Record index
+ * @param[out] *pxRecord  Record
+ * @return  (bool)      true, if a capture is replayed and has the record
+ * @date  19.10.2026
+ ******************************************************************************/
+bool bStub_CSRs_ReplayGetRecord(uint32_t ulIndex, csr_trace_record* pxRecord)
+{
+  if ((pvReplayMap == NULL) || (ulIndex >= ulReplayCount)) return false;
+
+  *pxRecord = pxReplayRecords[ulIndex];
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Check the CSR read accesses against the replayed capture
+ *
+ * @note Needs to be called after the code under test finished, since records
+ * not read yet are reported as a divergence, and before the replay is stopped.
+ *
+ * @return  (const char*) Description of the first divergence
+ * @retval  NULL          All recorded accesses were made, in order
+ * @date  19.10.2026
+ ******************************************************************************/
+const char* pszStub_CSRs_ReplayCheck(void)
 {
-  ++ulMisaAccessCount;
-  return ulMisaValue;
+  if ((acReplayMsg[0] == '\0') && (ulReplayNext < ulReplayCount))
+  {
+    snprintf(acReplayMsg, sizeof(acReplayMsg),
+             "access %lu (order %lu): recorded read of CSR 0x%03x not made",
+             (unsigned long)ulReplayNext,
+             (unsigned long)pxReplayRecords[ulReplayNext].ulOrder,
+             (unsigned)pxReplayRecords[ulReplayNext].uwCsr);
+  }
+  return (acReplayMsg[0] != '\0') ? acReplayMsg : NULL;
 }
@@ -5,6 +5,9 @@
  * @brief
  * Hardware CSR Stub
  *
+ * CSR reads are served from assigned values, or replayed from a capture file
+ * in the format of csr_trace.h. All reads may be recorded into a capture.
+ *
  * @date  29.05.2023
  ******************************************************************************/
 
@@ -12,14 +15,38 @@
 #define STUB_CSRS_H_
 
 /*- Header files -------------------------------------------------------------*/
+#include <stdbool.h>
 #include <stdint.h>
+#include "hw_layer.h"
+#include "../../FW_RV32CoreIdent/hw_layer/csr_trace.h"
+
+
+/*- Macros -------------------------------------------------------------------*/
+/*! MISA value with the MXL field of a 32-bit register                        */
+#define STUB_MISA_RV32_MXL(mxl)   ((uint64_t)(mxl) << 30)
+
+/*! MISA value with the MXL field of a 64-bit register                        */
+#define STUB_MISA_RV64_MXL(mxl)   ((uint64_t)(mxl) << 62)
+
+/*! MISA value with the MXL field of the simulated register width             */
+#define STUB_MISA_MXL(mxl)        ((uint64_t)(mxl) << (HW_XLEN - 2))
 
 
 /*- Access functions ---------------------------------------------------------*/
 void vStub_CSRs_Reset(void);
-void vStub_CSRs_SetMisa(uint32_t ulValue);
+void vStub_CSRs_SetMisa(uint64_t ullValue);
 uint32_t ulStub_CSRs_GetMisaAccessCount(void);
 
-uint32_t ulStub_CSRs_GetMisa(void);
+uint32_t ulStub_CSRs_GetMisa32(void);
+uint64_t ullStub_CSRs_GetMisa64(void);
+
+
+/*- Capture record/replay functions ------------------------------------------*/
+bool bStub_CSRs_RecordStart(const char* pszFile);
+bool bStub_CSRs_RecordStop(void);
+bool bStub_CSRs_ReplayStart(const char* pszFile);
+void vStub_CSRs_ReplayStop(void);
+bool bStub_CSRs_ReplayGetRecord(uint32_t ulIndex, csr_trace_record* pxRecord);
+const char* pszStub_CSRs_ReplayCheck(void);
 
 #endif /* STUB_CSRS_H_ */
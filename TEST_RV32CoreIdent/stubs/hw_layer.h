@@ -14,9 +14,25 @@
 /*- Header files -------------------------------------------------------------*/
 #include <stddef.h>
 #include <stdint.h>
+#include "Stub_CSRs.h"
+
+
+/*- Register width -----------------------------------------------------------*/
+/*! Simulated register width in bits, selected by the test build (32 or 64)   */
+#ifndef HW_XLEN
+#define HW_XLEN                   32
+#endif
 
 
 /*- Redirection of hardware functions to stub implementation -----------------*/
-#define __get_MISA()              ulStub_CSRs_GetMisa()
+#if HW_XLEN == 32
+typedef uint32_t hw_reg;
+#define HW_GET_MISA()             ulStub_CSRs_GetMisa32()
+#elif HW_XLEN == 64
+typedef uint64_t hw_reg;
+#define HW_GET_MISA()             ullStub_CSRs_GetMisa64()
+#else
+#error "Unsupported simulated register width"
+#endif
 
 #endif /* HW_LAYER_H_ */
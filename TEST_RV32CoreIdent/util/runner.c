@@ -0,0 +1,1069 @@
+/*!****************************************************************************
+ * @file
+ * runner.c
+ *
+ * @brief
+ * Test runner extension for CuTest
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+/*- Header files -------------------------------------------------------------*/
+#include <fnmatch.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "runner.h"
+
+
+/*- Macros -------------------------------------------------------------------*/
+/*! Report title                                                              */
+#ifdef CUTEST_PROJECT_NAME
+#define RUNNER_TITLE              CUTEST_PROJECT_NAME
+#else
+#define RUNNER_TITLE              "Unit-Test"
+#endif
+
+/*! Maximum length of a single name used for pattern matching                 */
+#define RUNNER_NAME_MAX_LEN       (128u)
+
+/*! Closing result record of a worker, holding the worker duration            */
+#define RUNNER_WORKER_END         ((size_t)-1)
+
+
+/*- Type definitions ---------------------------------------------------------*/
+/*! Resolved test case, in run order                                          */
+typedef struct
+{
+  const runner_module* pxModule;      /*!< Test module                        */
+  const runner_group* pxGroup;        /*!< Test group                         */
+  const void* pvParam;                /*!< Test parameter, or NULL            */
+  const char* pszParam;               /*!< Test parameter name, or NULL       */
+  const char* pszCase;                /*!< Test case name                     */
+  TestFunction pfTest;                /*!< Test case function                 */
+  bool bSelected;                     /*!< Selected by the name patterns      */
+} runner_entry;
+
+/*! Entry of the slowest test cases list                                      */
+typedef struct
+{
+  const runner_entry* pxEntry;        /*!< Test case                          */
+  uint64_t ullDurationNs;             /*!< Test case duration                 */
+} runner_timing;
+
+/*! Test case result, passed from a worker process through a pipe             */
+typedef struct
+{
+  size_t ulEntry;                     /*!< Index into the name index          */
+  bool bFailed;                       /*!< Test case failed                   */
+  uint64_t ullDurationNs;             /*!< Test case duration                 */
+  char acMessage[RUNNER_MESSAGE_MAX_LEN]; /*!< Failure message                */
+} runner_result;
+
+/*! Worker process running the test cases of one parameter                    */
+typedef struct
+{
+  pid_t xPid;                         /*!< Process ID, or -1 if not forked    */
+  FILE* pxPipe;                       /*!< Read end of the result pipe        */
+} runner_worker;
+
+
+/*- Linker section bounds ----------------------------------------------------*/
+extern const runner_case __start_runner_cases[] __attribute__((weak));
+extern const runner_case __stop_runner_cases[] __attribute__((weak));
+extern const runner_group __start_runner_groups[] __attribute__((weak));
+extern const runner_group __stop_runner_groups[] __attribute__((weak));
+extern const runner_module __start_runner_modules[] __attribute__((weak));
+extern const runner_module __stop_runner_modules[] __attribute__((weak));
+
+
+/*- Private variables --------------------------------------------------------*/
+/*! Name index: all test cases of all modules, in run order                   */
+static runner_entry* axEntries;
+static size_t ulEntryCount;
+
+/*! Include/exclude name patterns                                             */
+static const char** apszIncludes;
+static size_t ulIncludeCount;
+static const char** apszExcludes;
+static size_t ulExcludeCount;
+
+/*! Run options                                                               */
+static bool bListOnly;
+static bool bFailFast;
+static bool bStopped;
+static bool bNoneSelected;
+static size_t ulJobs;
+
+/*! Report output streams                                                     */
+static FILE* pxHtml;
+static FILE* pxJUnit;
+
+/*! Run statistics                                                            */
+static unsigned long ulRunCount;
+static unsigned long ulFailCount;
+static uint64_t ullRunStartNs;
+
+/*! Slowest test cases, in descending order                                   */
+static runner_timing axSlowest[RUNNER_SLOWEST_N];
+static size_t ulSlowestLen;
+
+/*! Report state of the module being run                                      */
+static bool bModuleOpen;
+static const runner_entry* pxGroupEntry;
+static uint64_t ullModuleNs;
+static uint64_t ullGroupStartNs;
+static uint64_t ullGroupWorkerNs;
+static bool bGroupInWorker;
+static unsigned long ulGroupFails;
+
+/*! Parameter of the running test case                                        */
+static const void* pvCurrentParam;
+
+
+/*- Private functions --------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Read the monotonic clock
+ *
+ * @return  (uint64_t)  Current time in nanoseconds
+ * @date  19.10.2026
+ ******************************************************************************/
+static uint64_t ullGetTimeNs(void)
+{
+  struct timespec xNow;
+  clock_gettime(CLOCK_MONOTONIC, &xNow);
+  return (uint64_t)xNow.tv_sec * 1000000000ull + (uint64_t)xNow.tv_nsec;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Compare two pointers for sorting and searching
+ *
+ * @param[in] pvA         First pointer
+ * @param[in] pvB         Second pointer
+ * @return  (int)       <0, 0 or >0 for ordering
+ * @date  19.10.2026
+ ******************************************************************************/
+static int iComparePtr(const void* pvA, const void* pvB)
+{
+  uintptr_t a = (uintptr_t)pvA;
+  uintptr_t b = (uintptr_t)pvB;
+  return (a > b) - (a < b);
+}
+
+/*!****************************************************************************
+ * @brief
+ * qsort() comparators for the case and group lookup tables
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static int iCompareCases(const void* pvA, const void* pvB)
+{
+  return iComparePtr((const void*)(*(const runner_case* const*)pvA)->pfTest,
+                     (const void*)(*(const runner_case* const*)pvB)->pfTest);
+}
+
+static int iCompareGroups(const void* pvA, const void* pvB)
+{
+  return iComparePtr((*(const runner_group* const*)pvA)->ppfBegin,
+                     (*(const runner_group* const*)pvB)->ppfBegin);
+}
+
+/*!****************************************************************************
+ * @brief
+ * bsearch() comparators for the case and group lookup tables
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static int iFindCase(const void* pvKey, const void* pvEntry)
+{
+  return iComparePtr(pvKey,
+                     (const void*)(*(const runner_case* const*)pvEntry)->pfTest);
+}
+
+static int iFindGroup(const void* pvKey, const void* pvEntry)
+{
+  return iComparePtr(pvKey, (*(const runner_group* const*)pvEntry)->ppfBegin);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Format the group name of a test case
+ *
+ * Test cases of parameterised groups are named "Group/Parameter", with a
+ * separator that is no glob syntax, so listed names can be used as patterns.
+ *
+ * @param[out] *acBuffer  Output buffer
+ * @param[in] ulSize      Output buffer size
+ * @param[in] *pxEntry    Test case
+ * @return  (const char*) Group name
+ * @date  19.10.2026
+ ******************************************************************************/
+static const char* pszFormatGroup(char* acBuffer, size_t ulSize,
+                                  const runner_entry* pxEntry)
+{
+  if (pxEntry->pszParam == NULL) return pxEntry->pxGroup->pszName;
+
+  snprintf(acBuffer, ulSize, "%s/%s", pxEntry->pxGroup->pszName,
+           pxEntry->pszParam);
+  return acBuffer;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Check a test case against a list of name patterns
+ *
+ * A pattern matches, if it matches the module name, the "Module.Group" path
+ * or the "Module.Group.Case" path, so selecting a module or group selects all
+ * of its test cases. Test cases of parameterised groups are matched both with
+ * and without the "/Parameter" part of the group name, so a group is selected
+ * as a whole or a single parameter of it.
+ *
+ * @param[in] *apszPatterns Glob patterns (fnmatch syntax)
+ * @param[in] ulCount     Number of patterns
+ * @param[in] *pxEntry    Test case
+ * @return  (bool)      true, if any pattern matches
+ * @date  19.10.2026
+ ******************************************************************************/
+static bool bMatchesAny(const char** apszPatterns, size_t ulCount,
+                        const runner_entry* pxEntry)
+{
+  char acName[2u * RUNNER_NAME_MAX_LEN];
+  char acModule[RUNNER_NAME_MAX_LEN];
+  char aacGroup[2][4u * RUNNER_NAME_MAX_LEN];
+  char aacCase[2][5u * RUNNER_NAME_MAX_LEN];
+
+  /* Paths with the plain group name, and with the parameter if there is one */
+  snprintf(acModule, sizeof(acModule), "%s", pxEntry->pxModule->pszName);
+  snprintf(aacGroup[0], sizeof(aacGroup[0]), "%s.%s", acModule,
+           pxEntry->pxGroup->pszName);
+  snprintf(aacGroup[1], sizeof(aacGroup[1]), "%s.%s", acModule,
+           pszFormatGroup(acName, sizeof(acName), pxEntry));
+  size_t ulPaths = (pxEntry->pszParam != NULL) ? 2u : 1u;
+  for (size_t p = 0u; p < ulPaths; ++p)
+  {
+    snprintf(aacCase[p], sizeof(aacCase[p]), "%s.%s", aacGroup[p],
+             pxEntry->pszCase);
+  }
+
+  for (size_t i = 0u; i < ulCount; ++i)
+  {
+    if (fnmatch(apszPatterns[i], acModule, 0) == 0) return true;
+    for (size_t p = 0u; p < ulPaths; ++p)
+    {
+      if ((fnmatch(apszPatterns[i], aacGroup[p], 0) == 0) ||
+          (fnmatch(apszPatterns[i], aacCase[p], 0) == 0)) return true;
+    }
+  }
+  return false;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Build the name index from the linker sections and resolve the selection
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vBuildIndex(void)
+{
+  /* Lookup tables for case and group names, sorted by address */
+  size_t ulCaseLen = (size_t)(__stop_runner_cases - __start_runner_cases);
+  const runner_case** apxCases = calloc(ulCaseLen + 1u, sizeof(*apxCases));
+  for (size_t i = 0u; i < ulCaseLen; ++i) apxCases[i] = &__start_runner_cases[i];
+  qsort(apxCases, ulCaseLen, sizeof(*apxCases), iCompareCases);
+
+  size_t ulGroupLen = (size_t)(__stop_runner_groups - __start_runner_groups);
+  const runner_group** apxGroups = calloc(ulGroupLen + 1u, sizeof(*apxGroups));
+  for (size_t i = 0u; i < ulGroupLen; ++i) apxGroups[i] = &__start_runner_groups[i];
+  qsort(apxGroups, ulGroupLen, sizeof(*apxGroups), iCompareGroups);
+
+  /* Resolve every module into its test cases */
+  size_t ulCapacity = 0u;
+  ulEntryCount = 0u;
+  for (const runner_module* pxModule = __start_runner_modules;
+       pxModule < __stop_runner_modules; ++pxModule)
+  {
+    for (const TestFunction* const* pppfGroup = pxModule->pppfBegin;
+         pppfGroup < pxModule->pppfEnd; ++pppfGroup)
+    {
+      const runner_group** ppxGroup = bsearch(*pppfGroup, apxGroups,
+        ulGroupLen, sizeof(*apxGroups), iFindGroup);
+      if (ppxGroup == NULL) continue;
+
+      /* Parameterised groups repeat all of their test cases per parameter */
+      const runner_group* pxGroup = *ppxGroup;
+      size_t ulParamCount = (pxGroup->pvParams != NULL) ? pxGroup->ulParamCount : 1u;
+
+      for (size_t p = 0u; p < ulParamCount; ++p)
+      {
+        const void* pvParam = (pxGroup->pvParams != NULL)
+          ? (const void*)((const char*)pxGroup->pvParams + p * pxGroup->ulParamSize)
+          : NULL;
+
+        for (const TestFunction* ppfCase = pxGroup->ppfBegin;
+             ppfCase < pxGroup->ppfEnd; ++ppfCase)
+        {
+          if (ulEntryCount == ulCapacity)
+          {
+            ulCapacity = (ulCapacity > 0u) ? 2u * ulCapacity : 64u;
+            axEntries = realloc(axEntries, ulCapacity * sizeof(*axEntries));
+          }
+
+          const runner_case** ppxCase = bsearch((const void*)*ppfCase, apxCases,
+            ulCaseLen, sizeof(*apxCases), iFindCase);
+
+          runner_entry* pxEntry = &axEntries[ulEntryCount++];
+          pxEntry->pxModule = pxModule;
+          pxEntry->pxGroup = pxGroup;
+          pxEntry->pvParam = pvParam;
+          pxEntry->pszParam = (pvParam != NULL) ? *(const char* const*)pvParam : NULL;
+          pxEntry->pszCase = (ppxCase != NULL) ? (*ppxCase)->pszName : "(unnamed)";
+          pxEntry->pfTest = *ppfCase;
+          pxEntry->bSelected =
+            ((ulIncludeCount == 0u) || bMatchesAny(apszIncludes, ulIncludeCount, pxEntry)) &&
+            !bMatchesAny(apszExcludes, ulExcludeCount, pxEntry);
+        }
+      }
+    }
+  }
+
+  free(apxCases);
+  free(apxGroups);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Write a string, escaping HTML/XML special characters
+ *
+ * @param[in] *pxFile     Output stream
+ * @param[in] *pszStr     String to be written (may be NULL)
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vWriteEscaped(FILE* pxFile, const char* pszStr)
+{
+  if (pszStr == NULL) return;
+
+  for (; *pszStr != '\0'; ++pszStr)
+  {
+    switch (*pszStr)
+    {
+    case '&':   fputs("&amp;", pxFile);   break;
+    case '<':   fputs("&lt;", pxFile);    break;
+    case '>':   fputs("&gt;", pxFile);    break;
+    case '"':   fputs("&quot;", pxFile);  break;
+    case '\'':  fputs("&#39;", pxFile);   break;
+    default:    fputc(*pszStr, pxFile);   break;
+    }
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Insert a test case into the slowest test cases list
+ *
+ * @param[in] *pxTiming   Test case timing
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vUpdateSlowest(const runner_timing* pxTiming)
+{
+  size_t i = (ulSlowestLen < RUNNER_SLOWEST_N) ? ulSlowestLen++ : RUNNER_SLOWEST_N;
+
+  while ((i > 0u) && (axSlowest[i - 1u].ullDurationNs < pxTiming->ullDurationNs))
+  {
+    if (i < RUNNER_SLOWEST_N) axSlowest[i] = axSlowest[i - 1u];
+    --i;
+  }
+  if (i < RUNNER_SLOWEST_N) axSlowest[i] = *pxTiming;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Write the "Module.Group.Case" path of a test case
+ *
+ * @param[in] *pxFile     Output stream
+ * @param[in] *pxEntry    Test case
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vWritePath(FILE* pxFile, const runner_entry* pxEntry)
+{
+  char acGroup[2u * RUNNER_NAME_MAX_LEN];
+
+  vWriteEscaped(pxFile, pxEntry->pxModule->pszName);
+  fputc('.', pxFile);
+  vWriteEscaped(pxFile, pszFormatGroup(acGroup, sizeof(acGroup), pxEntry));
+  fputc('.', pxFile);
+  vWriteEscaped(pxFile, pxEntry->pszCase);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run a single test case
+ *
+ * @param[in] ulEntry     Index of the test case in the name index
+ * @param[out] *pxResult  Test case result
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vExecuteCase(size_t ulEntry, runner_result* pxResult)
+{
+  const runner_entry* pxEntry = &axEntries[ulEntry];
+
+  pvCurrentParam = pxEntry->pvParam;
+  CuTest* pxTest = CuTestNew(pxEntry->pszCase, pxEntry->pfTest);
+  uint64_t ullStartNs = ullGetTimeNs();
+  CuTestRun(pxTest);
+  uint64_t ullDurationNs = ullGetTimeNs() - ullStartNs;
+  pvCurrentParam = NULL;
+
+  memset(pxResult, 0, sizeof(*pxResult));
+  pxResult->ulEntry = ulEntry;
+  pxResult->bFailed = (pxTest->failed != 0);
+  pxResult->ullDurationNs = ullDurationNs;
+  if (pxTest->failed && (pxTest->message != NULL))
+  {
+    snprintf(pxResult->acMessage, sizeof(pxResult->acMessage), "%s",
+             pxTest->message);
+  }
+
+  CuTestDelete(pxTest);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Open a test group in the report streams
+ *
+ * @param[in] *pxEntry    First test case of the group
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vOpenGroup(const runner_entry* pxEntry)
+{
+  char acGroup[2u * RUNNER_NAME_MAX_LEN];
+  const char* pszGroup = pszFormatGroup(acGroup, sizeof(acGroup), pxEntry);
+
+  if (!bModuleOpen && (pxHtml != NULL))
+  {
+    fputs("<h2>", pxHtml);
+    vWriteEscaped(pxHtml, pxEntry->pxModule->pszName);
+    fputs("</h2>\n<table>\n", pxHtml);
+  }
+  bModuleOpen = true;
+
+  pxGroupEntry = pxEntry;
+  ullGroupStartNs = ullGetTimeNs();
+  bGroupInWorker = false;
+  ulGroupFails = ulFailCount;
+
+  if (pxHtml != NULL)
+  {
+    fputs("<tr class=\"group\"><th colspan=\"4\">", pxHtml);
+    vWriteEscaped(pxHtml, pszGroup);
+    fputs("</th></tr>\n", pxHtml);
+  }
+  if (pxJUnit != NULL)
+  {
+    fputs("  <testsuite name=\"", pxJUnit);
+    vWriteEscaped(pxJUnit, pxEntry->pxModule->pszName);
+    fputc('.', pxJUnit);
+    vWriteEscaped(pxJUnit, pszGroup);
+    fputs("\">\n", pxJUnit);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Close the open test group in the report streams
+ *
+ * The group total is the time from opening to closing the group, or the time
+ * measured by the worker process that ran the group.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vCloseGroup(void)
+{
+  if (pxGroupEntry == NULL) return;
+
+  uint64_t ullGroupNs = bGroupInWorker ? ullGroupWorkerNs
+                                       : (ullGetTimeNs() - ullGroupStartNs);
+
+  if (pxHtml != NULL)
+  {
+    fprintf(pxHtml, "<tr class=\"%s\"><td><i>Group total</i></td><td></td>"
+                    "<td><i>%.3f us</i></td><td></td></tr>\n",
+            (ulFailCount != ulGroupFails) ? "fail" : "pass",
+            (double)ullGroupNs * 1e-3);
+    fflush(pxHtml);
+  }
+  if (pxJUnit != NULL)
+  {
+    fputs("  </testsuite>\n", pxJUnit);
+    fflush(pxJUnit);
+  }
+  pxGroupEntry = NULL;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Switch the report streams to the test group of a test case
+ *
+ * @param[in] *pxEntry    Test case
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vEnterGroup(const runner_entry* pxEntry)
+{
+  if ((pxGroupEntry != NULL) && (pxGroupEntry->pxGroup == pxEntry->pxGroup) &&
+      (pxGroupEntry->pvParam == pxEntry->pvParam)) return;
+
+  vCloseGroup();
+  vOpenGroup(pxEntry);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Report a test case result
+ *
+ * Opens the module and the test group of the test case in the report streams,
+ * if this was not done before it started running.
+ *
+ * @param[in] *pxResult   Test case result
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vReportCase(const runner_result* pxResult)
+{
+  const runner_entry* pxEntry = &axEntries[pxResult->ulEntry];
+  char acGroup[2u * RUNNER_NAME_MAX_LEN];
+
+  vEnterGroup(pxEntry);
+
+  ++ulRunCount;
+  if (pxResult->bFailed)
+  {
+    ++ulFailCount;
+    if (bFailFast) bStopped = true;
+  }
+  ullModuleNs += pxResult->ullDurationNs;
+
+  runner_timing xTiming = { pxEntry, pxResult->ullDurationNs };
+  vUpdateSlowest(&xTiming);
+
+  if (pxResult->bFailed)
+  {
+    printf("FAIL %s.%s.%s: %s\n", pxEntry->pxModule->pszName,
+           pszFormatGroup(acGroup, sizeof(acGroup), pxEntry), pxEntry->pszCase,
+           pxResult->acMessage);
+  }
+
+  if (pxHtml != NULL)
+  {
+    fprintf(pxHtml, "<tr class=\"%s\"><td>", pxResult->bFailed ? "fail" : "pass");
+    vWriteEscaped(pxHtml, pxEntry->pszCase);
+    fprintf(pxHtml, "</td><td>%s</td><td>%.3f us</td><td>",
+            pxResult->bFailed ? "FAIL" : "PASS",
+            (double)pxResult->ullDurationNs * 1e-3);
+    if (pxResult->bFailed) vWriteEscaped(pxHtml, pxResult->acMessage);
+    fputs("</td></tr>\n", pxHtml);
+    fflush(pxHtml);
+  }
+
+  if (pxJUnit != NULL)
+  {
+    fputs("    <testcase classname=\"", pxJUnit);
+    vWriteEscaped(pxJUnit, pxEntry->pxModule->pszName);
+    fputc('.', pxJUnit);
+    vWriteEscaped(pxJUnit, pszFormatGroup(acGroup, sizeof(acGroup), pxEntry));
+    fputs("\" name=\"", pxJUnit);
+    vWriteEscaped(pxJUnit, pxEntry->pszCase);
+    fprintf(pxJUnit, "\" time=\"%.6f\"", (double)pxResult->ullDurationNs * 1e-9);
+    if (pxResult->bFailed)
+    {
+      fputs(">\n      <failure message=\"", pxJUnit);
+      vWriteEscaped(pxJUnit, pxResult->acMessage);
+      fputs("\"/>\n    </testcase>\n", pxJUnit);
+    }
+    else fputs("/>\n", pxJUnit);
+    fflush(pxJUnit);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run the selected test cases of a range of the name index in this process
+ *
+ * @param[in] ulFirst     First test case
+ * @param[in] ulEnd       End of the range
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vRunRange(size_t ulFirst, size_t ulEnd)
+{
+  runner_result xResult;
+
+  for (size_t i = ulFirst; (i < ulEnd) && !bStopped; ++i)
+  {
+    if (!axEntries[i].bSelected) continue;
+    vEnterGroup(&axEntries[i]);
+    vExecuteCase(i, &xResult);
+    vReportCase(&xResult);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Fork a worker process running the selected test cases of a range
+ *
+ * The worker writes one result record per test case into a pipe, followed by
+ * a closing record with the time it took to run them, and exits. If no worker
+ * can be forked, the range is run in this process on collection.
+ *
+ * @param[out] *pxWorker  Worker process
+ * @param[in] ulFirst     First test case
+ * @param[in] ulEnd       End of the range
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vLaunchWorker(runner_worker* pxWorker, size_t ulFirst, size_t ulEnd)
+{
+  int aiPipe[2];
+
+  pxWorker->xPid = -1;
+  pxWorker->pxPipe = NULL;
+  if (pipe(aiPipe) != 0) return;
+
+  /* Nothing buffered may be written twice */
+  fflush(NULL);
+
+  pid_t xPid = fork();
+  if (xPid == 0)
+  {
+    runner_result xResult;
+    uint64_t ullStartNs = ullGetTimeNs();
+
+    close(aiPipe[0]);
+    for (size_t i = ulFirst; i < ulEnd; ++i)
+    {
+      if (!axEntries[i].bSelected) continue;
+      vExecuteCase(i, &xResult);
+      if (write(aiPipe[1], &xResult, sizeof(xResult)) != (ssize_t)sizeof(xResult)) break;
+      if (xResult.bFailed && bFailFast) break;
+    }
+
+    memset(&xResult, 0, sizeof(xResult));
+    xResult.ulEntry = RUNNER_WORKER_END;
+    xResult.ullDurationNs = ullGetTimeNs() - ullStartNs;
+    /* A lost closing record only loses the group duration */
+    ssize_t lWritten = write(aiPipe[1], &xResult, sizeof(xResult));
+    (void)lWritten;
+    close(aiPipe[1]);
+    _exit(EXIT_SUCCESS);
+  }
+
+  close(aiPipe[1]);
+  if (xPid < 0)
+  {
+    close(aiPipe[0]);
+    return;
+  }
+  pxWorker->xPid = xPid;
+  pxWorker->pxPipe = fdopen(aiPipe[0], "rb");
+}
+
+/*!****************************************************************************
+ * @brief
+ * Collect and report the results of a worker process
+ *
+ * A worker terminating before it reported all of its test cases fails the
+ * next test case. Once the test run is stopped, the worker is killed.
+ *
+ * @param[in] *pxWorker   Worker process
+ * @param[in] ulFirst     First test case of the worker
+ * @param[in] ulEnd       End of the range of the worker
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vCollectWorker(const runner_worker* pxWorker, size_t ulFirst, size_t ulEnd)
+{
+  runner_result xResult;
+  size_t ulNext = ulFirst;
+  int iStatus = 0;
+
+  if (pxWorker->xPid < 0)
+  {
+    vRunRange(ulFirst, ulEnd);
+    return;
+  }
+
+  if (bStopped) kill(pxWorker->xPid, SIGKILL);
+  else vEnterGroup(&axEntries[ulFirst]);
+
+  while ((pxWorker->pxPipe != NULL) &&
+         (fread(&xResult, sizeof(xResult), 1u, pxWorker->pxPipe) == 1u))
+  {
+    if (!bStopped && (xResult.ulEntry == RUNNER_WORKER_END))
+    {
+      ullGroupWorkerNs = xResult.ullDurationNs;
+      bGroupInWorker = true;
+      continue;
+    }
+    if (bStopped || (xResult.ulEntry < ulNext) || (xResult.ulEntry >= ulEnd)) continue;
+    vReportCase(&xResult);
+    ulNext = xResult.ulEntry + 1u;
+  }
+  if (pxWorker->pxPipe != NULL) fclose(pxWorker->pxPipe);
+  waitpid(pxWorker->xPid, &iStatus, 0);
+
+  if (bStopped || (WIFEXITED(iStatus) && (WEXITSTATUS(iStatus) == EXIT_SUCCESS))) return;
+
+  while ((ulNext < ulEnd) && !axEntries[ulNext].bSelected) ++ulNext;
+  if (ulNext == ulEnd) return;
+
+  memset(&xResult, 0, sizeof(xResult));
+  xResult.ulEntry = ulNext;
+  xResult.bFailed = true;
+  if (WIFSIGNALED(iStatus))
+  {
+    snprintf(xResult.acMessage, sizeof(xResult.acMessage),
+             "Worker process terminated by signal %d", WTERMSIG(iStatus));
+  }
+  else
+  {
+    snprintf(xResult.acMessage, sizeof(xResult.acMessage),
+             "Worker process exited with status %d", WEXITSTATUS(iStatus));
+  }
+  vReportCase(&xResult);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run the selected test cases of a parameterised test group in parallel
+ *
+ * Each parameter runs in a worker process, with up to ulJobs workers at a
+ * time. Results are collected in parameter order, so the reports do not
+ * depend on the scheduling of the workers.
+ *
+ * @param[in] ulFirst     First test case of the group
+ * @param[in] ulEnd       End of the group
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vRunParallel(size_t ulFirst, size_t ulEnd)
+{
+  /* Results of the preceding group are complete, so it must not be charged
+   * for launching the workers */
+  vCloseGroup();
+
+  /* Split the group into parameters with selected test cases */
+  size_t* aulStart = calloc((ulEnd - ulFirst) + 1u, sizeof(*aulStart));
+  size_t ulBlocks = 0u;
+  for (size_t i = ulFirst; i < ulEnd; ++i)
+  {
+    if (!axEntries[i].bSelected) continue;
+    if ((ulBlocks == 0u) || (axEntries[aulStart[ulBlocks - 1u]].pvParam != axEntries[i].pvParam))
+    {
+      aulStart[ulBlocks++] = i;
+    }
+  }
+  aulStart[ulBlocks] = ulEnd;
+
+  runner_worker* axWorkers = calloc(ulBlocks + 1u, sizeof(*axWorkers));
+  size_t ulLaunched = 0u;
+  for (size_t ulDone = 0u; ulDone < ulBlocks; ++ulDone)
+  {
+    while ((ulLaunched < ulBlocks) && (ulLaunched - ulDone < ulJobs) && !bStopped)
+    {
+      vLaunchWorker(&axWorkers[ulLaunched], aulStart[ulLaunched], aulStart[ulLaunched + 1u]);
+      ++ulLaunched;
+    }
+    if (ulDone == ulLaunched) break;
+    vCollectWorker(&axWorkers[ulDone], aulStart[ulDone], aulStart[ulDone + 1u]);
+  }
+
+  free(axWorkers);
+  free(aulStart);
+}
+
+/*!****************************************************************************
+ * @brief
+ * Print the command line usage
+ *
+ * @param[in] *pxStream   Output stream
+ * @param[in] *pszProgram Program name
+ * @date  19.10.2026
+ ******************************************************************************/
+static void vPrintUsage(FILE* pxStream, const char* pszProgram)
+{
+  fprintf(pxStream,
+    "Usage: %s [-i PATTERN]... [-x PATTERN]... [-l] [-f] [-j N] [-h]\n"
+    "  -i PATTERN  Run only test cases matching PATTERN (may be repeated)\n"
+    "  -x PATTERN  Skip test cases matching PATTERN (may be repeated)\n"
+    "  -l          List the selected test cases without running them\n"
+    "  -f          Stop after the first failing test case\n"
+    "  -j N        Run up to N parameters of a parameterised group in parallel\n"
+    "              (default: number of online CPUs, 1 runs in this process)\n"
+    "  -h          Show this help\n"
+    "PATTERN is a glob matched against \"Module\", \"Module.Group\" and\n"
+    "\"Module.Group.Case\", e.g. -i '*.TestCoreId_GetExtensionName'. Groups\n"
+    "of parameterised tests match as \"Group\" and as \"Group/Parameter\".\n",
+    pszProgram);
+}
+
+
+/*- Exported functions -------------------------------------------------------*/
+/*!****************************************************************************
+ * @brief
+ * Parse the test runner command line options
+ *
+ * @note
+ * Needs to be called before BEGIN_TEST_RUN(). The patterns are referenced,
+ * not copied, so argv needs to stay valid for the whole test run.
+ *
+ * @note
+ * With -h, the usage is printed and the process exits successfully.
+ *
+ * @param[in] argc        Argument count
+ * @param[in] *argv[]     Argument vector
+ * @return  (bool)      true, if the test run may continue
+ * @date  19.10.2026
+ ******************************************************************************/
+bool bRunner_ParseArgs(int argc, char* argv[])
+{
+  apszIncludes = calloc((size_t)argc + 1u, sizeof(*apszIncludes));
+  apszExcludes = calloc((size_t)argc + 1u, sizeof(*apszExcludes));
+  ulIncludeCount = 0u;
+  ulExcludeCount = 0u;
+  bListOnly = false;
+  bFailFast = false;
+  long lCpus = sysconf(_SC_NPROCESSORS_ONLN);
+  ulJobs = (lCpus > 0) ? (size_t)lCpus : 1u;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if ((strcmp(argv[i], "-i") == 0) && (i + 1 < argc))
+    {
+      apszIncludes[ulIncludeCount++] = argv[++i];
+    }
+    else if ((strcmp(argv[i], "-x") == 0) && (i + 1 < argc))
+    {
+      apszExcludes[ulExcludeCount++] = argv[++i];
+    }
+    else if (strcmp(argv[i], "-l") == 0)
+    {
+      bListOnly = true;
+    }
+    else if (strcmp(argv[i], "-f") == 0)
+    {
+      bFailFast = true;
+    }
+    else if ((strcmp(argv[i], "-j") == 0) && (i + 1 < argc) && (atoi(argv[i + 1]) > 0))
+    {
+      ulJobs = (size_t)atoi(argv[++i]);
+    }
+    else if (strcmp(argv[i], "-h") == 0)
+    {
+      vPrintUsage(stdout, argv[0]);
+      exit(EXIT_SUCCESS);
+    }
+    else
+    {
+      vPrintUsage(stderr, argv[0]);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Start a test run: build the name index and open the report streams
+ *
+ * @note
+ * In list mode, the selected test cases are printed and no report is written.
+ * If the -i patterns select no test case at all, the test run fails.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void vRunner_Begin(void)
+{
+  vBuildIndex();
+  ulRunCount = 0u;
+  ulFailCount = 0u;
+  ulSlowestLen = 0u;
+  bStopped = false;
+
+  bNoneSelected = (ulIncludeCount > 0u);
+  for (size_t i = 0u; bNoneSelected && (i < ulEntryCount); ++i)
+  {
+    bNoneSelected = !axEntries[i].bSelected;
+  }
+  if (bNoneSelected) fprintf(stderr, "No test case matches the -i patterns\n");
+
+  if (bListOnly)
+  {
+    char acGroup[2u * RUNNER_NAME_MAX_LEN];
+
+    for (size_t i = 0u; i < ulEntryCount; ++i)
+    {
+      if (!axEntries[i].bSelected) continue;
+      printf("%s.%s.%s\n", axEntries[i].pxModule->pszName,
+             pszFormatGroup(acGroup, sizeof(acGroup), &axEntries[i]),
+             axEntries[i].pszCase);
+    }
+    return;
+  }
+
+  pxHtml = fopen(RUNNER_HTML_FILE, "w");
+  if (pxHtml != NULL)
+  {
+    fputs("<!DOCTYPE html>\n<html><head><meta charset=\"utf-8\"><title>", pxHtml);
+    vWriteEscaped(pxHtml, RUNNER_TITLE);
+    fputs("</title><style>"
+          "body{font-family:sans-serif}table{border-collapse:collapse}"
+          "td,th{border:1px solid #ccc;padding:2px 8px;text-align:left}"
+          ".pass td:nth-child(2){color:green}.fail td:nth-child(2){color:red}"
+          ".group th{background:#eee}"
+          "</style></head><body>\n<h1>", pxHtml);
+    vWriteEscaped(pxHtml, RUNNER_TITLE);
+    fputs("</h1>\n", pxHtml);
+  }
+  else perror(RUNNER_HTML_FILE);
+
+  pxJUnit = fopen(RUNNER_JUNIT_FILE, "w");
+  if (pxJUnit != NULL)
+  {
+    fputs("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites name=\"", pxJUnit);
+    vWriteEscaped(pxJUnit, RUNNER_TITLE);
+    fputs("\">\n", pxJUnit);
+  }
+  else perror(RUNNER_JUNIT_FILE);
+
+  ullRunStartNs = ullGetTimeNs();
+}
+
+/*!****************************************************************************
+ * @brief
+ * Run the selected test cases of a test module
+ *
+ * @param[in] *pxModule   Test module
+ * @date  19.10.2026
+ ******************************************************************************/
+void vRunner_RunModule(const runner_module* pxModule)
+{
+  if (bListOnly) return;
+
+  bModuleOpen = false;
+  pxGroupEntry = NULL;
+  ullModuleNs = 0u;
+
+  size_t i = 0u;
+  while ((i < ulEntryCount) && (axEntries[i].pxModule != pxModule)) ++i;
+
+  while ((i < ulEntryCount) && (axEntries[i].pxModule == pxModule) && !bStopped)
+  {
+    size_t ulEnd = i + 1u;
+    while ((ulEnd < ulEntryCount) && (axEntries[ulEnd].pxModule == pxModule) &&
+           (axEntries[ulEnd].pxGroup == axEntries[i].pxGroup)) ++ulEnd;
+
+    if ((axEntries[i].pvParam != NULL) && (ulJobs > 1u)) vRunParallel(i, ulEnd);
+    else vRunRange(i, ulEnd);
+    i = ulEnd;
+  }
+
+  vCloseGroup();
+
+  if (bModuleOpen && (pxHtml != NULL))
+  {
+    fprintf(pxHtml, "</table>\n<p>Module total: %.3f us</p>\n",
+            (double)ullModuleNs * 1e-3);
+    fflush(pxHtml);
+  }
+}
+
+/*!****************************************************************************
+ * @brief
+ * Finish a test run: write the summary and close the report streams
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+void vRunner_End(void)
+{
+  uint64_t ullRunNs = ullGetTimeNs() - ullRunStartNs;
+
+  if (!bListOnly)
+  {
+    if (bStopped) printf("Stopped after the first failing test case\n");
+    printf("%s: %lu of %lu tests passed (%.3f ms)\n", RUNNER_TITLE,
+           ulRunCount - ulFailCount, ulRunCount, (double)ullRunNs * 1e-6);
+    printf("Slowest %zu test cases:\n", ulSlowestLen);
+    for (size_t i = 0u; i < ulSlowestLen; ++i)
+    {
+      const runner_entry* pxEntry = axSlowest[i].pxEntry;
+      char acGroup[2u * RUNNER_NAME_MAX_LEN];
+      printf("  %10.3f us  %s.%s.%s\n", (double)axSlowest[i].ullDurationNs * 1e-3,
+             pxEntry->pxModule->pszName,
+             pszFormatGroup(acGroup, sizeof(acGroup), pxEntry), pxEntry->pszCase);
+    }
+  }
+
+  if (pxHtml != NULL)
+  {
+    fprintf(pxHtml, "<h2>Summary</h2>\n<p>%lu of %lu tests passed in %.3f ms%s</p>\n",
+            ulRunCount - ulFailCount, ulRunCount, (double)ullRunNs * 1e-6,
+            bStopped ? " (stopped after the first failing test case)" : "");
+    fprintf(pxHtml, "<h3>Slowest %zu test cases</h3>\n<table>\n", ulSlowestLen);
+    for (size_t i = 0u; i < ulSlowestLen; ++i)
+    {
+      fputs("<tr><td>", pxHtml);
+      vWritePath(pxHtml, axSlowest[i].pxEntry);
+      fprintf(pxHtml, "</td><td>%.3f us</td></tr>\n",
+              (double)axSlowest[i].ullDurationNs * 1e-3);
+    }
+    fputs("</table>\n</body></html>\n", pxHtml);
+    fclose(pxHtml);
+    pxHtml = NULL;
+  }
+
+  if (pxJUnit != NULL)
+  {
+    fputs("</testsuites>\n", pxJUnit);
+    fclose(pxJUnit);
+    pxJUnit = NULL;
+  }
+
+  free(axEntries);
+  free(apszIncludes);
+  free(apszExcludes);
+  axEntries = NULL;
+  apszIncludes = NULL;
+  apszExcludes = NULL;
+  ulEntryCount = 0u;
+  ulIncludeCount = 0u;
+  ulExcludeCount = 0u;
+  ulSlowestLen = 0u;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get the test run result
+ *
+ * @return  (int)       Test run result
+ * @retval  EXIT_SUCCESS  All test cases passed
+ * @retval  EXIT_FAILURE  At least one test case failed, or none was selected
+ * @date  19.10.2026
+ ******************************************************************************/
+int iRunner_GetResult(void)
+{
+  return ((ulFailCount == 0u) && !bNoneSelected) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*!****************************************************************************
+ * @brief
+ * Get the parameter of the running test case
+ *
+ * @return  (const void*) Entry of the parameter table of the test group, or
+ *                      NULL, if the test group is not parameterised
+ * @date  19.10.2026
+ ******************************************************************************/
+const void* pvRunner_GetParam(void)
+{
+  return pvCurrentParam;
+}
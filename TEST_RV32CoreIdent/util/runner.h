@@ -0,0 +1,169 @@
+/*!****************************************************************************
+ * @file
+ * runner.h
+ *
+ * @brief
+ * Test runner extension for CuTest
+ *
+ * Re-binds the TEST_CASE/TEST_GROUP/TEST_MODULE macros, so that every test
+ * case, group and module is described by a named entry in a linker section.
+ * The runner builds its name index from these sections once at startup, runs
+ * each test case through the CuTest core and times it with a monotonic clock.
+ * Results are streamed into the HTML report and a JUnit XML file as the tests
+ * finish. Test cases can be selected by name patterns on the command line.
+ *
+ * Parameterised test groups run all of their test cases once per entry of a
+ * parameter table. Each parameter runs in a forked worker process, up to a
+ * configurable number of workers at a time, and is reported as a group of
+ * its own named "Group/Parameter".
+ *
+ * @note
+ * This header needs to be included **after <CuTest.h>** in every test module
+ * and in the test runner main file. Test case, group and module definitions
+ * keep their usual syntax.
+ *
+ * @note
+ * Descriptors are packed into their sections with pointer alignment, so that
+ * each section can be walked as an array. The section bounds rely on the
+ * "__start_" and "__stop_" symbols generated by the GNU linker for sections
+ * named like C identifiers.
+ *
+ * @date  19.10.2026
+ ******************************************************************************/
+
+#ifndef UTIL_RUNNER_H_
+#define UTIL_RUNNER_H_
+
+/*- Header files -------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <CuTest.h>
+
+
+/*- Macros -------------------------------------------------------------------*/
+/*! Output file for the HTML report                                           */
+#ifndef RUNNER_HTML_FILE
+#define RUNNER_HTML_FILE          "report.html"
+#endif
+
+/*! Output file for the JUnit XML report                                      */
+#ifndef RUNNER_JUNIT_FILE
+#define RUNNER_JUNIT_FILE         "report.xml"
+#endif
+
+/*! Number of slowest test cases listed in the reports                        */
+#ifndef RUNNER_SLOWEST_N
+#define RUNNER_SLOWEST_N          (5u)
+#endif
+
+/*! Maximum length of a failure message reported by a worker process          */
+#ifndef RUNNER_MESSAGE_MAX_LEN
+#define RUNNER_MESSAGE_MAX_LEN    (512u)
+#endif
+
+
+/*- Type definitions ---------------------------------------------------------*/
+/*! Test case descriptor                                                      */
+typedef struct
+{
+  const char* pszName;                /*!< Test case name                     */
+  TestFunction pfTest;                /*!< Test case function                 */
+} runner_case;
+
+/*! Test group descriptor                                                     */
+typedef struct
+{
+  const char* pszName;                /*!< Test group name                    */
+  const TestFunction* ppfBegin;       /*!< First test case of the group       */
+  const TestFunction* ppfEnd;         /*!< End of the test case list          */
+  const void* pvParams;               /*!< Parameter table, or NULL           */
+  size_t ulParamSize;                 /*!< Size of a parameter table entry    */
+  size_t ulParamCount;                /*!< Number of parameter table entries  */
+} runner_group;
+
+/*! Test module descriptor                                                    */
+typedef struct
+{
+  const char* pszName;                /*!< Test module name                   */
+  const TestFunction* const* pppfBegin; /*!< First test group of the module   */
+  const TestFunction* const* pppfEnd; /*!< End of the test group list         */
+} runner_module;
+
+
+/*- Test definition macros ---------------------------------------------------*/
+#undef TEST_CASE
+#undef TEST_GROUP
+#undef TEST_MODULE
+#undef EXTERN_TEST_MODULE
+
+/*! Descriptor attributes: kept by the linker, packed with pointer alignment  */
+#define RUNNER_DESC(sect)                                                     \
+  __attribute__((used, aligned(sizeof(void*)), section(sect)))
+
+/*! Test case definition, followed by the function body                       */
+#define TEST_CASE(name)                                                       \
+  static void name(CuTest* tc);                                               \
+  static const runner_case name##_xRunnerDesc RUNNER_DESC("runner_cases") =   \
+    { #name, name };                                                          \
+  static void name(CuTest* tc)
+
+/*! Test group definition, followed by a list of test cases                   */
+#define TEST_GROUP(name)                                                      \
+  extern const TestFunction __start_runner_grp_##name[];                      \
+  extern const TestFunction __stop_runner_grp_##name[];                       \
+  static const runner_group name##_xRunnerDesc RUNNER_DESC("runner_groups") = \
+    { #name, __start_runner_grp_##name, __stop_runner_grp_##name,             \
+      NULL, 0u, 0u };                                                         \
+  static const TestFunction name[]                                            \
+    __attribute__((used, section("runner_grp_" #name))) =
+
+/*!
+ * Parameterised test group definition, followed by a list of test cases
+ *
+ * The test cases run once per entry of the parameter table and fetch their
+ * entry with pvRunner_GetParam(). The first member of a parameter table entry
+ * needs to be its name (const char*).
+ */
+#define TEST_PARAM_GROUP(name, params, count)                                 \
+  extern const TestFunction __start_runner_grp_##name[];                      \
+  extern const TestFunction __stop_runner_grp_##name[];                       \
+  static const runner_group name##_xRunnerDesc RUNNER_DESC("runner_groups") = \
+    { #name, __start_runner_grp_##name, __stop_runner_grp_##name,             \
+      (params), sizeof((params)[0]), (count) };                               \
+  static const TestFunction name[]                                            \
+    __attribute__((used, section("runner_grp_" #name))) =
+
+/*! Test module definition, followed by a list of test groups                 */
+#define TEST_MODULE(name)                                                     \
+  extern const TestFunction* const __start_runner_mod_##name[];               \
+  extern const TestFunction* const __stop_runner_mod_##name[];                \
+  const runner_module name RUNNER_DESC("runner_modules") =                    \
+    { #name, __start_runner_mod_##name, __stop_runner_mod_##name };           \
+  static const TestFunction* const name##_apGroups[]                          \
+    __attribute__((used, section("runner_mod_" #name))) =
+
+/*! Test module declaration for use in the test runner                        */
+#define EXTERN_TEST_MODULE(name)  extern const runner_module name
+
+
+/*- Test run macros ----------------------------------------------------------*/
+#undef BEGIN_TEST_RUN
+#undef RUN_TEST_MODULE
+#undef END_TEST_RUN
+#undef GET_RUN_RESULT
+
+#define BEGIN_TEST_RUN()          vRunner_Begin()
+#define RUN_TEST_MODULE(name)     vRunner_RunModule(&(name))
+#define END_TEST_RUN()            vRunner_End()
+#define GET_RUN_RESULT()          iRunner_GetResult()
+
+
+/*- Exported functions -------------------------------------------------------*/
+bool bRunner_ParseArgs(int argc, char* argv[]);
+void vRunner_Begin(void);
+void vRunner_RunModule(const runner_module* pxModule);
+void vRunner_End(void);
+int iRunner_GetResult(void);
+const void* pvRunner_GetParam(void);
+
+#endif /* UTIL_RUNNER_H_ */